@@ -0,0 +1,279 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#include "Commandlets/UEFImportCommandlet.h"
+#include "Factories/UEFAnimFactory.h"
+#include "Factories/UEFModelFactory.h"
+#include "Readers/UEFAnimReader.h"
+#include "Readers/UEFModelReader.h"
+#include "Animation/Skeleton.h"
+#include "Async/Async.h"
+#include "Engine/SkeletalMesh.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Misc/QueuedThreadPool.h"
+#include "ObjectTools.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+namespace
+{
+	struct FImportJob
+	{
+		FString Filename;
+		FString PackageName;
+		bool bIsAnim = false;
+	};
+
+	// Worker side of a job, the decoded file waiting for the game thread
+	struct FReadJob
+	{
+		TUniquePtr<UEFModelReader> Model;
+		TUniquePtr<UEFAnimReader> Anim;
+		TOptional<FUEFReadError> Error;
+		int64 FileSize = 0;
+		double ReadSeconds = 0.0;
+	};
+
+	struct FReportLine
+	{
+		FString Filename;
+		bool bIsAnim = false;
+		int64 FileSize = 0;
+		double ReadSeconds = 0.0;
+		double ImportSeconds = 0.0;
+		bool bSucceeded = false;
+		FString Message;
+	};
+
+	TUniquePtr<FReadJob> ReadFile(const FImportJob& Job)
+	{
+		TUniquePtr<FReadJob> Read = MakeUnique<FReadJob>();
+		Read->FileSize = IFileManager::Get().FileSize(*Job.Filename);
+
+		const double StartTime = FPlatformTime::Seconds();
+		if (Job.bIsAnim)
+			Read->Anim = MakeUnique<UEFAnimReader>(Job.Filename);
+		else
+			Read->Model = MakeUnique<UEFModelReader>(Job.Filename);
+		FUEFReadResult Result = Job.bIsAnim ? Read->Anim->Read() : Read->Model->Read();
+		Read->ReadSeconds = FPlatformTime::Seconds() - StartTime;
+
+		if (Result.HasError())
+		{
+			Read->Error = Result.StealError();
+			Read->Model.Reset();
+			Read->Anim.Reset();
+		}
+		return Read;
+	}
+
+	bool SaveAsset(UObject* Asset)
+	{
+		UPackage* Package = Asset->GetPackage();
+		const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+		SaveArgs.Error = GWarn;
+		return UPackage::SavePackage(Package, Asset, *Filename, SaveArgs);
+	}
+
+	// Package for File under Dest, keeping its directory relative to BaseDir when it is inside it
+	FString MakePackageName(const FString& File, const FString& BaseDir, const FString& Dest)
+	{
+		FString RelativeDir = FPaths::GetPath(File);
+		if (BaseDir.IsEmpty() || !FPaths::MakePathRelativeTo(RelativeDir, *(BaseDir / TEXT(""))) || RelativeDir.StartsWith(TEXT("..")))
+			RelativeDir.Reset();
+		RelativeDir = ObjectTools::SanitizeInvalidChars(RelativeDir, INVALID_LONGPACKAGE_CHARACTERS);
+
+		const FString AssetName = ObjectTools::SanitizeObjectName(FPaths::GetBaseFilename(File));
+		return RelativeDir.IsEmpty() ? Dest / AssetName : Dest / RelativeDir / AssetName;
+	}
+
+	bool IsUEFormatFile(const FString& File)
+	{
+		return FPaths::GetExtension(File).Equals(TEXT("uemodel"), ESearchCase::IgnoreCase) || FPaths::GetExtension(File).Equals(TEXT("ueanim"), ESearchCase::IgnoreCase);
+	}
+
+	bool CollectFiles(const FString& SourceDir, const FString& Manifest, TArray<FString>& OutFiles, FString& OutBaseDir)
+	{
+		if (!SourceDir.IsEmpty())
+		{
+			OutBaseDir = FPaths::ConvertRelativePathToFull(SourceDir);
+			IFileManager::Get().FindFilesRecursive(OutFiles, *OutBaseDir, TEXT("*.uemodel"), true, false);
+			IFileManager::Get().FindFilesRecursive(OutFiles, *OutBaseDir, TEXT("*.ueanim"), true, false, false);
+			return true;
+		}
+
+		TArray<FString> Lines;
+		if (!FFileHelper::LoadFileToStringArray(Lines, *Manifest))
+		{
+			UE_LOG(LogTemp, Error, TEXT("UEFImport: cannot read manifest %s"), *Manifest);
+			return false;
+		}
+		OutBaseDir = FPaths::GetPath(FPaths::ConvertRelativePathToFull(Manifest));
+		for (FString& Line : Lines)
+		{
+			Line.TrimStartAndEndInline();
+			if (Line.IsEmpty() || Line.StartsWith(TEXT("#")))
+				continue;
+			if (!IsUEFormatFile(Line))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("UEFImport: skipping %s, not a .uemodel or .ueanim file"), *Line);
+				continue;
+			}
+			OutFiles.Add(FPaths::IsRelative(Line) ? FPaths::ConvertRelativePathToFull(OutBaseDir, Line) : Line);
+		}
+		return true;
+	}
+}
+
+UUEFImportCommandlet::UUEFImportCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UUEFImportCommandlet::Main(const FString& Params)
+{
+	FString SourceDir, Manifest, Dest, SkeletonPath, ReportPath;
+	FParse::Value(*Params, TEXT("Source="), SourceDir);
+	FParse::Value(*Params, TEXT("Manifest="), Manifest);
+	FParse::Value(*Params, TEXT("Dest="), Dest);
+	FParse::Value(*Params, TEXT("Skeleton="), SkeletonPath);
+	FParse::Value(*Params, TEXT("Report="), ReportPath);
+	int32 NumWorkers = FMath::Max(1, FPlatformMisc::NumberOfWorkerThreadsToSpawn());
+	FParse::Value(*Params, TEXT("Workers="), NumWorkers);
+	NumWorkers = FMath::Max(1, NumWorkers);
+	const bool bSave = !FParse::Param(*Params, TEXT("NoSave"));
+
+	if (SourceDir.IsEmpty() == Manifest.IsEmpty() || !Dest.StartsWith(TEXT("/")))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Usage: -run=UEFImport (-Source=<Dir> | -Manifest=<File>) -Dest=/Game/<Path> [-Skeleton=<Skeleton>] [-Workers=<N>] [-Report=<CSV>] [-NoSave]"));
+		return 1;
+	}
+	Dest.RemoveFromEnd(TEXT("/"));
+
+	TArray<FString> Files;
+	FString BaseDir;
+	if (!CollectFiles(SourceDir, Manifest, Files, BaseDir))
+		return 1;
+
+	// Meshes first, so a run that imports skeletal meshes and their animations creates the meshes before anything else
+	TArray<FImportJob> Jobs;
+	Jobs.Reserve(Files.Num());
+	for (const FString& File : Files)
+		Jobs.Add({ File, MakePackageName(File, BaseDir, Dest), FPaths::GetExtension(File).Equals(TEXT("ueanim"), ESearchCase::IgnoreCase) });
+	Jobs.StableSort([](const FImportJob& A, const FImportJob& B) { return !A.bIsAnim && B.bIsAnim; });
+
+	USkeleton* Skeleton = SkeletonPath.IsEmpty() ? nullptr : LoadObject<USkeleton>(nullptr, *SkeletonPath);
+	if (!SkeletonPath.IsEmpty() && !Skeleton)
+	{
+		UE_LOG(LogTemp, Error, TEXT("UEFImport: cannot load skeleton %s"), *SkeletonPath);
+		return 1;
+	}
+
+	UEFModelFactory* ModelFactory = NewObject<UEFModelFactory>();
+	UEFAnimFactory* AnimFactory = NewObject<UEFAnimFactory>();
+	ModelFactory->AddToRoot();
+	AnimFactory->AddToRoot();
+	// Runs as one "Apply to All" batch, registry notifications and component reregistration happen once in CleanUp
+	AnimFactory->SettingsImporter->Skeleton = Skeleton;
+	AnimFactory->SettingsImporter->bInitialized = true;
+	AnimFactory->bImportAll = true;
+
+	UE_LOG(LogTemp, Display, TEXT("UEFImport: %d files to %s with %d workers"), Jobs.Num(), *Dest, NumWorkers);
+
+	// Workers read ahead of the game thread, at most two files each, so memory stays bounded on large asset sets
+	FQueuedThreadPool* Pool = FQueuedThreadPool::Allocate();
+	Pool->Create(NumWorkers, 512 * 1024, TPri_Normal, TEXT("UEFImportWorkers"));
+	const int32 MaxReadAhead = NumWorkers * 2;
+	TArray<TUniquePtr<FReadJob>> Reads;
+	TArray<TFuture<void>> Pending;
+	Reads.SetNum(Jobs.Num());
+	Pending.SetNum(Jobs.Num());
+	int32 NextRead = 0;
+
+	TArray<FReportLine> Report;
+	Report.Reserve(Jobs.Num());
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < Jobs.Num(); ++Index)
+	{
+		for (; NextRead < Jobs.Num() && NextRead - Index < MaxReadAhead; ++NextRead)
+			Pending[NextRead] = AsyncPool(*Pool, [&Jobs, &Reads, JobIndex = NextRead]() { Reads[JobIndex] = ReadFile(Jobs[JobIndex]); });
+		Pending[Index].Wait();
+
+		const FImportJob& Job = Jobs[Index];
+		TUniquePtr<FReadJob> Read = MoveTemp(Reads[Index]);
+		FReportLine& Line = Report.AddDefaulted_GetRef();
+		Line.Filename = Job.Filename;
+		Line.bIsAnim = Job.bIsAnim;
+		Line.FileSize = Read->FileSize;
+		Line.ReadSeconds = Read->ReadSeconds;
+
+		if (Read->Error.IsSet())
+			Line.Message = Read->Error->ToString();
+		else
+		{
+			const double ImportStart = FPlatformTime::Seconds();
+			UPackage* Package = CreatePackage(*Job.PackageName);
+			Package->FullyLoad();
+			const FName AssetName(*FPackageName::GetShortName(Job.PackageName));
+			const EObjectFlags Flags = RF_Public | RF_Standalone | RF_Transactional;
+			UObject* Asset = Job.bIsAnim
+				? AnimFactory->ImportFromReader(*Read->Anim, Package, AssetName, Flags)
+				: ModelFactory->ImportFromReader(*Read->Model, Package, AssetName, Flags);
+
+			Line.bSucceeded = Asset != nullptr;
+			if (!Asset)
+				Line.Message = TEXT("import failed, see log");
+			else if (bSave)
+			{
+				bool bSaved = SaveAsset(Asset);
+				if (USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(Asset); SkeletalMesh && SkeletalMesh->GetSkeleton())
+					bSaved &= SaveAsset(SkeletalMesh->GetSkeleton());
+				Line.bSucceeded = bSaved;
+				if (!bSaved)
+					Line.Message = TEXT("save failed");
+			}
+			Line.ImportSeconds = FPlatformTime::Seconds() - ImportStart;
+		}
+		Read.Reset();
+
+		const double Seconds = Line.ReadSeconds + Line.ImportSeconds;
+		UE_LOG(LogTemp, Display, TEXT("UEFImport: [%d/%d] %s %s, %.1f KB, read %.1f ms, import %.1f ms, %.2f MB/s%s%s"),
+			Index + 1, Jobs.Num(), Line.bSucceeded ? TEXT("OK") : TEXT("FAILED"), *Job.Filename, Line.FileSize / 1024.0,
+			Line.ReadSeconds * 1000.0, Line.ImportSeconds * 1000.0, Seconds > 0.0 ? Line.FileSize / (1024.0 * 1024.0) / Seconds : 0.0,
+			Line.Message.IsEmpty() ? TEXT("") : TEXT(": "), *Line.Message);
+	}
+	Pool->Destroy();
+	delete Pool;
+
+	AnimFactory->CleanUp();
+	ModelFactory->RemoveFromRoot();
+	AnimFactory->RemoveFromRoot();
+
+	const double WallSeconds = FPlatformTime::Seconds() - StartTime;
+	int32 NumFailed = 0;
+	int64 TotalBytes = 0;
+	FString Csv = TEXT("File,Type,Bytes,ReadMs,ImportMs,MBps,Result,Message\n");
+	for (const FReportLine& Line : Report)
+	{
+		NumFailed += Line.bSucceeded ? 0 : 1;
+		TotalBytes += Line.FileSize;
+		const double Seconds = Line.ReadSeconds + Line.ImportSeconds;
+		Csv += FString::Printf(TEXT("\"%s\",%s,%lld,%.3f,%.3f,%.3f,%s,\"%s\"\n"), *Line.Filename, Line.bIsAnim ? TEXT("anim") : TEXT("model"),
+			Line.FileSize, Line.ReadSeconds * 1000.0, Line.ImportSeconds * 1000.0, Seconds > 0.0 ? Line.FileSize / (1024.0 * 1024.0) / Seconds : 0.0,
+			Line.bSucceeded ? TEXT("OK") : TEXT("FAILED"), *Line.Message.Replace(TEXT("\""), TEXT("'")));
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("UEFImport: %d imported, %d failed, %.1f MB in %.2f s (%.2f MB/s)"),
+		Report.Num() - NumFailed, NumFailed, TotalBytes / (1024.0 * 1024.0), WallSeconds, WallSeconds > 0.0 ? TotalBytes / (1024.0 * 1024.0) / WallSeconds : 0.0);
+	if (!ReportPath.IsEmpty() && !FFileHelper::SaveStringToFile(Csv, *ReportPath))
+		UE_LOG(LogTemp, Error, TEXT("UEFImport: cannot write report %s"), *ReportPath);
+
+	return NumFailed > 0 ? 1 : 0;
+}
@@ -1,13 +1,16 @@
 ﻿// Copyright © 2025 Marcel K. All rights reserved.
 
 #include "Factories/UEFAnimFactory.h"
+#include "UEFKeyResampler.h"
 #include "ComponentReregisterContext.h"
 #include "Animation/AnimSequence.h"
 #include "Widgets/Anim/UEFAnimImportOptions.h"
 #include "Widgets/Anim/UEFAnimWidget.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Interfaces/IMainFrameModule.h"
+#include "Misc/App.h"
 #include "Misc/FeedbackContext.h"
 #include "Misc/ScopedSlowTask.h"
 #include "Readers/UEFAnimReader.h"
@@ -22,6 +25,16 @@ UEFAnimFactory::UEFAnimFactory(const FObjectInitializer & ObjectInitializer): Su
 	SettingsImporter = CreateDefaultSubobject<UEFAnimImportOptions>(TEXT("Anim Options"));
 }
 
+// Tracks are resampled this many at a time, which bounds the scratch memory for long clips with many bones
+static constexpr int32 ResampleBatchSize = 64;
+
+struct FResampledTrack
+{
+	TArray<FVector3f> PosKeys;
+	TArray<FQuat4f> RotKeys;
+	TArray<FVector3f> ScaleKeys;
+};
+
 UObject* UEFAnimFactory::FactoryCreateFile(UClass* Class, UObject* Parent, FName Name, EObjectFlags Flags, const FString& Filename, const TCHAR* Params, FFeedbackContext* Warn, bool& bOutOperationCanceled)
 {
 	FScopedSlowTask SlowTask(5, NSLOCTEXT("UEFAnimFactory", "BeginReadUEAnimFile", "Reading UEAnim file"), true);
@@ -31,11 +44,14 @@ UObject* UEFAnimFactory::FactoryCreateFile(UClass* Class, UObject* Parent, FName
 	SlowTask.EnterProgressFrame(0);
 
 	UEFAnimReader Data = UEFAnimReader(Filename);
-	if (!Data.Read())
+	if (FUEFReadResult Result = Data.Read(); Result.HasError())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to read %s: %s"), *Filename, *Result.GetError().ToString());
 		return nullptr;
+	}
 
-	//Ui
-	if (SettingsImporter->bInitialized == false)
+	//Ui, unattended runs (commandlets, build machines) import with the options as they are
+	if (SettingsImporter->bInitialized == false && !FApp::IsUnattended())
 	{
 		TSharedPtr<UEFAnimWidget> ImportOptionsWindow;
 		TSharedPtr<SWindow> ParentWindow;
@@ -54,9 +70,22 @@ UObject* UEFAnimFactory::FactoryCreateFile(UClass* Class, UObject* Parent, FName
 		SettingsImporter->bInitialized = true;
 	}
 
+	return ImportFromReader(Data, Parent, Name, Flags);
+}
+
+UObject* UEFAnimFactory::ImportFromReader(UEFAnimReader& Data, UObject* Parent, FName Name, EObjectFlags Flags)
+{
+	USkeleton* Skeleton = SettingsImporter->Skeleton;
+	if (!Skeleton)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Cannot import %s without a target skeleton"), *Name.ToString());
+		if (!bImportAll)
+			SettingsImporter->bInitialized = false;
+		return nullptr;
+	}
+
 	UAnimSequence* AnimSequence = NewObject<UAnimSequence>(Parent, Name, Flags);
 	IAnimationDataController& Controller = AnimSequence->GetController();
-	USkeleton* Skeleton = SettingsImporter->Skeleton;
 
 	AnimSequence->SetSkeleton(Skeleton);
 	Controller.OpenBracket(FText::FromString("Importing UEAnim Animation"));
@@ -70,79 +99,61 @@ UObject* UEFAnimFactory::FactoryCreateFile(UClass* Class, UObject* Parent, FName
 	ImportTask.MakeDialog(false);
 
 	//Import Tracks
-	for (const auto& Track : Data.Tracks)
+	//Each batch is resampled on worker threads, one task per track stream, then handed to the controller on this thread.
+	//Every track resamples to NumFrames, so the batch buffers keep their allocation for the whole import.
+	const EUEFAnimInterpolation Interpolation = SettingsImporter->Interpolation;
+	const int64 ResampledBytes = static_cast<int64>(Data.Tracks.Num()) * Data.NumFrames * (sizeof(FVector3f) * 2 + sizeof(FQuat4f));
+	const bool bParallelResample = ShouldDecodeInParallel(ResampledBytes);
+	TArray<FResampledTrack> Batch;
+	Batch.SetNum(FMath::Min(ResampleBatchSize, Data.Tracks.Num()));
+	for (auto BatchStart = 0; BatchStart < Data.Tracks.Num(); BatchStart += ResampleBatchSize)
 	{
-		ImportTask.EnterProgressFrame();
-
-		FName BoneName = Track.TrackName.c_str();
-		auto PosKeys = Track.TrackPosKeys;
-		auto RotKeys = Track.TrackRotKeys;
-		auto ScaleKeys = Track.TrackScaleKeys;
-
-		TArray<FVector3f> FinalPosKeys;
-		TArray<FQuat4f> FinalRotKeys;
-		TArray<FVector3f> FinalScaleKeys;
-		FinalPosKeys.SetNum(Data.NumFrames);
-		FinalRotKeys.SetNum(Data.NumFrames);
-		FinalScaleKeys.SetNum(Data.NumFrames);
-
-		FVector3f PrevPos = FVector3f::ZeroVector;
-		FQuat4f PrevRot = FQuat4f::Identity;
-		FVector3f PrevScale = FVector3f::OneVector;
-
-		int PosIndex = 0, RotIndex = 0, ScaleIndex = 0;
-		for (auto j = 0; j < Data.NumFrames; j++)
+		const int32 BatchNum = FMath::Min(ResampleBatchSize, Data.Tracks.Num() - BatchStart);
+		ParallelFor(BatchNum * 3, [&, BatchStart](int32 Index)
 		{
-			//position keys
-			if (PosIndex < PosKeys.Num() && PosKeys[PosIndex].Frame == j)
-			{
-				FinalPosKeys[j] = PosKeys[PosIndex].VectorValue;
-				PrevPos = PosKeys[PosIndex].VectorValue;
-				PosIndex++;
-			}
-			else
-				FinalPosKeys[j] = PrevPos;
-			
-			//rotation keys
-			if (RotIndex < RotKeys.Num() && RotKeys[RotIndex].Frame == j)
+			const FTrack& Track = Data.Tracks[BatchStart + Index / 3];
+			FResampledTrack& Resampled = Batch[Index / 3];
+			switch (Index % 3)
 			{
-				FinalRotKeys[j] = RotKeys[RotIndex].QuatValue;
-				PrevRot = RotKeys[RotIndex].QuatValue;
-				RotIndex++;
+			case 0:
+				UEFResampleKeys(Track.PosKeys, Data.NumFrames, Interpolation, FVector3f::ZeroVector, Resampled.PosKeys);
+				break;
+			case 1:
+				UEFResampleKeys(Track.RotKeys, Data.NumFrames, Interpolation, FQuat4f::Identity, Resampled.RotKeys);
+				break;
+			default:
+				UEFResampleKeys(Track.ScaleKeys, Data.NumFrames, Interpolation, FVector3f::OneVector, Resampled.ScaleKeys);
+				break;
 			}
-			else
-				FinalRotKeys[j] = PrevRot;
+		}, !bParallelResample);
 
-			//scale keys
-			if (ScaleIndex < ScaleKeys.Num() && ScaleKeys[ScaleIndex].Frame == j)
-			{
-				FinalScaleKeys[j] = ScaleKeys[ScaleIndex].VectorValue;
-				PrevScale = ScaleKeys[ScaleIndex].VectorValue;
-				ScaleIndex++;
-			}
-			else
-				FinalScaleKeys[j] = PrevScale;
-		}
+		for (auto i = 0; i < BatchNum; i++)
+		{
+			ImportTask.EnterProgressFrame();
 
-		Controller.AddBoneCurve(BoneName);
-		Controller.SetBoneTrackKeys(BoneName, FinalPosKeys, FinalRotKeys, FinalScaleKeys);
+			const FName BoneName = Data.Names.Get(Data.Tracks[BatchStart + i].TrackName);
+			Controller.AddBoneCurve(BoneName);
+			Controller.SetBoneTrackKeys(BoneName, Batch[i].PosKeys, Batch[i].RotKeys, Batch[i].ScaleKeys);
+		}
 	}
 
 	//Import Curves
+	TArray<FRichCurveKey> RichCurves;
 	for (auto i = 0; i < Data.Curves.Num(); i++)
 	{
 		ImportTask.EnterProgressFrame();
 
-		TArray<FRichCurveKey> RichCurves;
-		for (const auto& Key : Data.Curves[i].CurveKeys)
+		const TUEFKeyStream<float>& Keys = Data.Curves[i].Keys;
+		RichCurves.Reset(Keys.Num());
+		for (auto k = 0; k < Keys.Num(); k++)
 		{
 			FRichCurveKey RichKey;
-			RichKey.Time = Key.Frame / Data.FramesPerSecond; //Time is in seconds
-			RichKey.Value = Key.FloatValue;
+			RichKey.Time = Keys.Frames[k] / Data.FramesPerSecond; //Time is in seconds
+			RichKey.Value = Keys.Values[k];
 			RichCurves.Add(RichKey);
 		}
 
-		FAnimationCurveIdentifier CurveIdentifier(Data.Curves[i].CurveName.c_str(), ERawCurveTrackTypes::RCT_Float);
+		FAnimationCurveIdentifier CurveIdentifier(Data.Names.Get(Data.Curves[i].CurveName), ERawCurveTrackTypes::RCT_Float);
 		Controller.AddCurve(CurveIdentifier);
 		Controller.SetCurveKeys(CurveIdentifier, RichCurves, false);
 	}
@@ -154,8 +165,40 @@ UObject* UEFAnimFactory::FactoryCreateFile(UClass* Class, UObject* Parent, FName
 	AnimSequence->GetController().CloseBracket();
 	AnimSequence->PostEditChange();
 
-	FAssetRegistryModule::AssetCreated(AnimSequence);
-	FGlobalComponentReregisterContext RecreateComponents;
+	if (bImportAll)
+		PendingAssets.Add(AnimSequence);
+	else
+	{
+		FAssetRegistryModule::AssetCreated(AnimSequence);
+		FGlobalComponentReregisterContext RecreateComponents;
+	}
 
 	return AnimSequence;
 }
+
+void UEFAnimFactory::CleanUp()
+{
+	Super::CleanUp();
+
+	// The import batch is over, the next one asks for options again
+	FlushPendingAssets();
+	bImportAll = false;
+	if (SettingsImporter)
+		SettingsImporter->bInitialized = false;
+}
+
+void UEFAnimFactory::FlushPendingAssets()
+{
+	if (PendingAssets.IsEmpty())
+		return;
+
+	for (UObject* Asset : PendingAssets)
+	{
+		if (Asset)
+			FAssetRegistryModule::AssetCreated(Asset);
+	}
+	PendingAssets.Empty();
+
+	// One reregistration picks up every sequence of the batch
+	FGlobalComponentReregisterContext RecreateComponents;
+}
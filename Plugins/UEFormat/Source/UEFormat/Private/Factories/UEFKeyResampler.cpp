@@ -0,0 +1,127 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#include "UEFKeyResampler.h"
+
+namespace
+{
+	// Longest interpolated span ReduceKeys checks before keeping a key, each new key re-checks up to this many
+	constexpr int32 MaxReducedSpan = 32;
+
+	FORCEINLINE FVector3f Interpolate(const FVector3f& A, const FVector3f& B, float Alpha)
+	{
+		return FMath::Lerp(A, B, Alpha);
+	}
+
+	FORCEINLINE FQuat4f Interpolate(const FQuat4f& A, const FQuat4f& B, float Alpha)
+	{
+		return FQuat4f::Slerp(A, B, Alpha);
+	}
+
+	FORCEINLINE float Error(const FVector3f& A, const FVector3f& B)
+	{
+		return FVector3f::Dist(A, B);
+	}
+
+	// Taken from the shorter chord between A and B rather than from their dot product, whose acos is off by a few
+	// hundredths of a degree for identical rotations at float precision
+	FORCEINLINE float Error(const FQuat4f& A, const FQuat4f& B)
+	{
+		const float DiffSquared = FMath::Square(A.X - B.X) + FMath::Square(A.Y - B.Y) + FMath::Square(A.Z - B.Z) + FMath::Square(A.W - B.W);
+		const float SumSquared = FMath::Square(A.X + B.X) + FMath::Square(A.Y + B.Y) + FMath::Square(A.Z + B.Z) + FMath::Square(A.W + B.W);
+		const float Chord = FMath::Sqrt(FMath::Min(DiffSquared, SumSquared));
+		return FMath::RadiansToDegrees(4.0f * FMath::Asin(0.5f * Chord));
+	}
+
+	// Value the span [From, To] produces at Frame
+	template<typename T>
+	FORCEINLINE T Evaluate(const TUEFKeyStream<T>& Keys, int32 From, int32 To, int32 Frame, EUEFAnimInterpolation Interpolation)
+	{
+		if (Interpolation == EUEFAnimInterpolation::Step || Keys.Frames[To] <= Keys.Frames[From])
+			return Keys.Values[From];
+		// In 64 bits, frames read from a damaged file can be any int32
+		const float Alpha = static_cast<float>(static_cast<int64>(Frame) - Keys.Frames[From]) / static_cast<float>(static_cast<int64>(Keys.Frames[To]) - Keys.Frames[From]);
+		return Interpolate(Keys.Values[From], Keys.Values[To], Alpha);
+	}
+
+	template<typename T>
+	void ReduceKeys(TUEFKeyStream<T>& Keys, EUEFAnimInterpolation Interpolation, float Tolerance)
+	{
+		const int32 Num = Keys.Num();
+		if (Num <= 2)
+			return;
+
+		// Greedy: a key is dropped while the span from the last kept key to its successor still reproduces every
+		// key dropped since. Kept keys are written at Kept, which never passes the keys still to be read.
+		// Stepping holds the anchor's value over the whole span, so only the newest dropped key needs checking.
+		// Interpolated spans are re-checked in full and capped at MaxReducedSpan keys to keep a stream linear.
+		int32 Anchor = 0;
+		int32 Kept = 1;
+		for (auto Index = 1; Index < Num - 1; Index++)
+		{
+			bool bRedundant = Interpolation == EUEFAnimInterpolation::Step || Index - Anchor < MaxReducedSpan;
+			const int32 FirstDropped = Interpolation == EUEFAnimInterpolation::Step ? Index : Anchor + 1;
+			for (auto Dropped = FirstDropped; Dropped <= Index && bRedundant; Dropped++)
+				bRedundant = Error(Evaluate(Keys, Anchor, Index + 1, Keys.Frames[Dropped], Interpolation), Keys.Values[Dropped]) <= Tolerance;
+			if (bRedundant)
+				continue;
+
+			Keys.Frames[Kept] = Keys.Frames[Index];
+			Keys.Values[Kept] = Keys.Values[Index];
+			Kept++;
+			Anchor = Index;
+		}
+		Keys.Frames[Kept] = Keys.Frames[Num - 1];
+		Keys.Values[Kept] = Keys.Values[Num - 1];
+		Kept++;
+
+		Keys.Frames = Keys.Frames.Left(Kept);
+		Keys.Values = Keys.Values.Left(Kept);
+	}
+
+	template<typename T>
+	void ResampleKeys(const TUEFKeyStream<T>& Keys, int32 NumFrames, EUEFAnimInterpolation Interpolation, const T& DefaultValue, TArray<T>& OutValues)
+	{
+		OutValues.SetNumUninitialized(NumFrames, EAllowShrinking::No);
+		if (Keys.IsEmpty())
+		{
+			for (auto Frame = 0; Frame < NumFrames; Frame++)
+				OutValues[Frame] = DefaultValue;
+			return;
+		}
+
+		// Next is the first key after Frame
+		int32 Next = 0;
+		for (auto Frame = 0; Frame < NumFrames; Frame++)
+		{
+			while (Next < Keys.Num() && Keys.Frames[Next] <= Frame)
+				Next++;
+
+			if (Next == 0)
+				OutValues[Frame] = Interpolation == EUEFAnimInterpolation::Step ? DefaultValue : Keys.Values[0];
+			else if (Next == Keys.Num())
+				OutValues[Frame] = Keys.Values[Next - 1];
+			else
+				OutValues[Frame] = Evaluate(Keys, Next - 1, Next, Frame, Interpolation);
+		}
+	}
+}
+
+void UEFReduceKeys(TUEFKeyStream<FVector3f>& Keys, EUEFAnimInterpolation Interpolation, float Tolerance)
+{
+	ReduceKeys(Keys, Interpolation, Tolerance);
+}
+
+void UEFReduceKeys(TUEFKeyStream<FQuat4f>& Keys, EUEFAnimInterpolation Interpolation, float Tolerance)
+{
+	ReduceKeys(Keys, Interpolation, Tolerance);
+}
+
+void UEFResampleKeys(const TUEFKeyStream<FVector3f>& Keys, int32 NumFrames, EUEFAnimInterpolation Interpolation, const FVector3f& DefaultValue, TArray<FVector3f>& OutValues)
+{
+	ResampleKeys(Keys, NumFrames, Interpolation, DefaultValue, OutValues);
+}
+
+void UEFResampleKeys(const TUEFKeyStream<FQuat4f>& Keys, int32 NumFrames, EUEFAnimInterpolation Interpolation, const FQuat4f& DefaultValue, TArray<FQuat4f>& OutValues)
+{
+	ResampleKeys(Keys, NumFrames, Interpolation, DefaultValue, OutValues);
+}
@@ -0,0 +1,21 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Readers/UEFAnimReader.h"
+#include "Widgets/Anim/UEFAnimImportOptions.h"
+
+// Turns the sparse key streams of a UEAnim track into the per-frame keys IAnimationDataController expects.
+// Frames are assumed to be ascending, as the exporter writes them.
+
+// Drops keys that the kept keys reproduce within Tolerance under Interpolation, measured as distance. The stream is
+// compacted in place and shortened, its first and last keys are always kept. Only worth it where keys stay sparse, so
+// UEFAnimWriter uses it per FUEFWriteOptions, the importer hands every frame to the controller anyway.
+void UEFReduceKeys(TUEFKeyStream<FVector3f>& Keys, EUEFAnimInterpolation Interpolation, float Tolerance);
+// Same for rotations, Tolerance is an angle in degrees.
+void UEFReduceKeys(TUEFKeyStream<FQuat4f>& Keys, EUEFAnimInterpolation Interpolation, float Tolerance);
+
+// Expands keys to one value per frame. Frames before the first key take DefaultValue when stepping and the first
+// key's value when interpolating, frames after the last key hold it.
+void UEFResampleKeys(const TUEFKeyStream<FVector3f>& Keys, int32 NumFrames, EUEFAnimInterpolation Interpolation, const FVector3f& DefaultValue, TArray<FVector3f>& OutValues);
+void UEFResampleKeys(const TUEFKeyStream<FQuat4f>& Keys, int32 NumFrames, EUEFAnimInterpolation Interpolation, const FQuat4f& DefaultValue, TArray<FQuat4f>& OutValues);
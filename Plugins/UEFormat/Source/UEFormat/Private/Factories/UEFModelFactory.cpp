@@ -1,6 +1,7 @@
 // Copyright © 2025 Marcel K. All rights reserved.
 
 #include "Factories/UEFModelFactory.h"
+#include "Factories/UEFSkinWeights.h"
 #include "StaticMeshAttributes.h"
 #include "Engine/StaticMesh.h"
 #include "Engine/SkeletalMesh.h"
@@ -9,9 +10,46 @@
 #include "SkeletalMeshAttributes.h"
 #include "StaticToSkeletalMeshConverter.h"
 #include "Engine/SkeletalMeshSocket.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
 
 class IMeshUtilities;
 
+// Vertex instances filled per ParallelFor task
+static constexpr int32 VertexInstanceBatchSize = 16 * 1024;
+
+static TAutoConsoleVariable<bool> CVarUEFormatWeldVertexInstances(
+	TEXT("UEFormat.Import.WeldVertexInstances"),
+	true,
+	TEXT("Create one vertex instance per distinct vertex a LOD's indices use, instead of one per index. Lossless, instance attributes come from the vertex."));
+
+static TAutoConsoleVariable<float> CVarUEFormatMorphDeltaThreshold(
+	TEXT("UEFormat.Import.MorphDeltaThreshold"),
+	0.0001f,
+	TEXT("Morph target deltas whose position and normal offsets are both no longer than this are dropped on import."));
+
+static TAutoConsoleVariable<bool> CVarUEFormatDropEmptyMorphTargets(
+	TEXT("UEFormat.Import.DropEmptyMorphTargets"),
+	false,
+	TEXT("Skip morph targets that have no deltas left after pruning. Saves a per-vertex array each, but curves and pose assets that name them no longer find them."));
+
+// Morph target deltas that survived pruning, one array per component
+struct FUEFMorphDeltas
+{
+	FName Name;
+	TArray<int32> Vertices;
+	TArray<FVector3f> Positions;
+};
+
+// LODs are built on separate threads when there is more than one and the mesh is big enough for it to pay off
+static bool ShouldProcessLODsInParallel(const TArray<FLODData>& LODData)
+{
+	int64 Bytes = 0;
+	for (const FLODData& Data : LODData)
+		Bytes += Data.Vertices.Num() * static_cast<int64>(sizeof(FVector3f)) + Data.Indices.Num() * static_cast<int64>(sizeof(int32));
+	return LODData.Num() > 1 && ShouldDecodeInParallel(Bytes);
+}
+
 UEFModelFactory::UEFModelFactory(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	Formats.Add(TEXT("uemodel; UEMODEL Mesh File"));
@@ -23,14 +61,24 @@ UEFModelFactory::UEFModelFactory(const FObjectInitializer& ObjectInitializer) :
 UObject* UEFModelFactory::FactoryCreateFile(UClass* Class, UObject* Parent, FName Name, EObjectFlags Flags, const FString& Filename, const TCHAR* Params, FFeedbackContext* Warn, bool& bOutOperationCanceled)
 {
 	UEFModelReader Data = UEFModelReader(Filename);
+	if (FUEFReadResult Result = Data.Read(); Result.HasError())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to read %s: %s"), *Filename, *Result.GetError().ToString());
+		return nullptr;
+	}
+	return ImportFromReader(Data, Parent, Name, Flags);
+}
+
+UObject* UEFModelFactory::ImportFromReader(UEFModelReader& Data, UObject* Parent, FName Name, EObjectFlags Flags)
+{
 	//empty mesh
-	if (!Data.Read() || Data.LODs.Num() == 0)
+	if (Data.LODs.Num() == 0)
 		return nullptr;
 
 	//skeletal mesh
 	if (Data.Skeleton.Bones.Num() > 0)
 	{
-		USkeletalMesh* SkeletalMesh = CreateSkeletalMesh(Data.LODs, Data.Skeleton, Parent, Name, Flags);
+		USkeletalMesh* SkeletalMesh = CreateSkeletalMesh(Data.LODs, Data.Skeleton, Data.Names, Parent, Name, Flags);
 
 		SkeletalMesh->PostEditChange();
 		FAssetRegistryModule::AssetCreated(SkeletalMesh);
@@ -38,7 +86,7 @@ UObject* UEFModelFactory::FactoryCreateFile(UClass* Class, UObject* Parent, FNam
 	}
 	else //static mesh
 	{
-		UStaticMesh* StaticMesh = CreateStaticMesh(Data.LODs, Parent, Name, Flags);
+		UStaticMesh* StaticMesh = CreateStaticMesh(Data.LODs, Data.Names, Parent, Name, Flags);
 
 		StaticMesh->PostEditChange();
 		FAssetRegistryModule::AssetCreated(StaticMesh);
@@ -46,12 +94,16 @@ UObject* UEFModelFactory::FactoryCreateFile(UClass* Class, UObject* Parent, FNam
 	}
 }
 
-void UEFModelFactory::PopulateMeshDescription(FMeshDescription& MeshDesc, FLODData& Data)
+void UEFModelFactory::PopulateMeshDescription(FMeshDescription& MeshDesc, FLODData& Data, FUEFVertexInstanceMap& Instances)
 {
+	Instances.Build(Data, CVarUEFormatWeldVertexInstances.GetValueOnAnyThread());
+
 	// Reserve space
 	MeshDesc.ReserveNewVertices(Data.Vertices.Num());
-	MeshDesc.ReserveNewVertexInstances(Data.Vertices.Num());
+	MeshDesc.ReserveNewVertexInstances(Instances.InstanceVertices.Num());
+	MeshDesc.ReserveNewTriangles(Data.Indices.Num() / 3);
 	MeshDesc.ReserveNewPolygons(Data.Indices.Num() / 3);
+	MeshDesc.ReserveNewEdges(Data.Indices.Num() / 2); // about 1.5 per triangle on a closed mesh
 	MeshDesc.ReserveNewPolygonGroups(Data.Materials.Num());
 	MeshDesc.SetNumUVChannels(Data.TextureCoordinates.Num());
 
@@ -59,52 +111,66 @@ void UEFModelFactory::PopulateMeshDescription(FMeshDescription& MeshDesc, FLODDa
 	for (auto i = 0; i < Data.Vertices.Num(); ++i)
 		MeshDesc.CreateVertex();
 
-	//Indices
-	for (const auto& Index : Data.Indices)
+	//Instances
+	for (const auto& Index : Instances.InstanceVertices)
 		MeshDesc.CreateVertexInstance(Index);
 }
 
-void UEFModelFactory::SetMeshAttributes(FMeshDescription& MeshDesc, FLODData& Data)
+void UEFModelFactory::SetMeshAttributes(FMeshDescription& MeshDesc, FLODData& Data, const FUEFVertexInstanceMap& Instances)
 {
 	FStaticMeshAttributes Attributes(MeshDesc);
 	Attributes.Register();
 
-	const auto VertexPositions = Attributes.GetVertexPositions();
-	const auto VertexInstanceNormals = Attributes.GetVertexInstanceNormals();
-	const auto VertexInstanceTangents = Attributes.GetVertexInstanceTangents();
-	const auto VertexInstanceBinormalSigns = Attributes.GetVertexInstanceBinormalSigns();
-	const auto VertexInstanceColors = Attributes.GetVertexInstanceColors();
 	const auto VertexInstanceUVs = Attributes.GetVertexInstanceUVs();
 	VertexInstanceUVs.SetNumChannels(Data.TextureCoordinates.Num());
 
-	//Vertices
-	for (auto i = 0; i < Data.Vertices.Num(); ++i)
-		VertexPositions.Set(i, Data.Vertices[i]);
+	//Elements were created in order on an empty description, so an element's ID is its index in the raw arrays
+	const TArrayView<FVector3f> VertexPositions = Attributes.GetVertexPositions().GetRawArray();
+	const TArrayView<FVector3f> VertexInstanceNormals = Attributes.GetVertexInstanceNormals().GetRawArray();
+	const TArrayView<FVector3f> VertexInstanceTangents = Attributes.GetVertexInstanceTangents().GetRawArray();
+	const TArrayView<float> VertexInstanceBinormalSigns = Attributes.GetVertexInstanceBinormalSigns().GetRawArray();
+	const TArrayView<FVector4f> VertexInstanceColors = Attributes.GetVertexInstanceColors().GetRawArray();
+	TArray<TArrayView<FVector2f>, TInlineAllocator<MAX_MESH_TEXTURE_COORDS_MD>> UVChannels;
+	for (auto u = 0; u < Data.TextureCoordinates.Num(); u++)
+		UVChannels.Add(VertexInstanceUVs.GetRawArray(u));
 
-	//Indices
-	for (auto i = 0; i < Data.Indices.Num(); i++) {
-		int Index = Data.Indices[i];
-
-		//Normals
-		if (Data.Normals.Num() > 0) {
-			VertexInstanceBinormalSigns.Set(i, Data.Normals[Index].X);
-			VertexInstanceNormals.Set(i, FVector3f(Data.Normals[Index].Y, Data.Normals[Index].Z, Data.Normals[Index].W));
+	//Vertices
+	check(VertexPositions.Num() >= Data.Vertices.Num());
+	FMemory::Memcpy(VertexPositions.GetData(), Data.Vertices.GetData(), Data.Vertices.Num() * sizeof(FVector3f));
+
+	//Instances
+	//Every instance only writes its own slots, so ranges of instances are filled on worker threads
+	const TConstArrayView<int32> InstanceVertices = Instances.InstanceVertices;
+	const int32 NumInstances = InstanceVertices.Num();
+	const int64 InstanceBytes = static_cast<int64>(NumInstances) * (sizeof(FVector3f) * 2 + sizeof(float) + sizeof(FVector4f) + UVChannels.Num() * sizeof(FVector2f));
+	const int32 NumBatches = FMath::DivideAndRoundUp(NumInstances, VertexInstanceBatchSize);
+	ParallelFor(NumBatches, [&Data, InstanceVertices, &VertexInstanceNormals, &VertexInstanceTangents, &VertexInstanceBinormalSigns, &VertexInstanceColors, &UVChannels, NumInstances](int32 Batch)
+	{
+		const int32 BatchEnd = FMath::Min((Batch + 1) * VertexInstanceBatchSize, NumInstances);
+		for (auto i = Batch * VertexInstanceBatchSize; i < BatchEnd; i++) {
+			int Index = InstanceVertices[i];
+
+			//Normals
+			if (Data.Normals.Num() > 0) {
+				VertexInstanceBinormalSigns[i] = Data.Normals[Index].X;
+				VertexInstanceNormals[i] = FVector3f(Data.Normals[Index].Y, Data.Normals[Index].Z, Data.Normals[Index].W);
+			}
+			//Tangents
+			if (Data.Tangents.Num() > 0)
+				VertexInstanceTangents[i] = Data.Tangents[Index];
+
+			//Vertex Colors
+			if (Data.VertexColors.Num() > 0)
+				VertexInstanceColors[i] = FVector4f(FLinearColor(Data.VertexColors[0].Data[Index]));
+
+			//Texture Coordinates
+			for (auto u = 0; u < UVChannels.Num(); u++)
+				UVChannels[u][i] = Data.TextureCoordinates[u][Index];
 		}
-		//Tangents
-		if (Data.Tangents.Num() > 0)
-			VertexInstanceTangents.Set(i, Data.Tangents[Index]);
-
-		//Vertex Colors
-		if (Data.VertexColors.Num() > 0)
-			VertexInstanceColors.Set(i, FVector4f(Data.VertexColors[0].Data[Index]));
-
-		//Texture Coordinates
-		for (auto u = 0; u < Data.TextureCoordinates.Num(); u++)
-			VertexInstanceUVs.Set(i, u, Data.TextureCoordinates[u][Index]);
-	}
+	}, !ShouldDecodeInParallel(InstanceBytes));
 }
 
-void UEFModelFactory::CreatePolygonGroups(FMeshDescription& MeshDesc, FLODData& Data)
+void UEFModelFactory::CreatePolygonGroups(FMeshDescription& MeshDesc, FLODData& Data, const FUEFVertexInstanceMap& Instances, const FUEFNameTable& Names)
 {
 	FStaticMeshAttributes Attributes(MeshDesc);
 	Attributes.Register();
@@ -112,34 +178,37 @@ void UEFModelFactory::CreatePolygonGroups(FMeshDescription& MeshDesc, FLODData&
 	for (const auto& [MatIndex, MatName, FirstIndex, NumFaces] : Data.Materials) {
 		FPolygonGroupID PolygonGroup = MeshDesc.CreatePolygonGroup();
 		for (auto i = FirstIndex; i < FirstIndex + (NumFaces * 3); i += 3)
-			MeshDesc.CreatePolygon(PolygonGroup, { i, i + 1, i + 2 });
+		{
+			const FVertexInstanceID Triangle[3] = { FVertexInstanceID(Instances.GetInstance(i)), FVertexInstanceID(Instances.GetInstance(i + 1)), FVertexInstanceID(Instances.GetInstance(i + 2)) };
+			MeshDesc.CreateTriangle(PolygonGroup, Triangle);
+		}
 
-		Attributes.GetPolygonGroupMaterialSlotNames()[PolygonGroup] = MatName.c_str();
+		Attributes.GetPolygonGroupMaterialSlotNames()[PolygonGroup] = Names.Get(MatName);
 	}
 }
 
-TArray<FStaticMaterial> UEFModelFactory::CreateStaticMaterials(TArray<FMaterialChunk> MaterialInfos)
+TArray<FStaticMaterial> UEFModelFactory::CreateStaticMaterials(TArray<FMaterialChunk> MaterialInfos, const FUEFNameTable& Names)
 {
 	TArray<FStaticMaterial> Materials;
 	for (const auto& MaterialInfo : MaterialInfos)
 	{
 		FStaticMaterial Material;
-		Material.MaterialSlotName = MaterialInfo.Name.c_str();
-		Material.ImportedMaterialSlotName = MaterialInfo.Name.c_str();
+		Material.MaterialSlotName = Names.Get(MaterialInfo.Name);
+		Material.ImportedMaterialSlotName = Names.Get(MaterialInfo.Name);
 		Material.MaterialInterface = nullptr;
 		Materials.Add(Material);
 	}
 	return Materials;
 }
 
-TArray<FSkeletalMaterial> UEFModelFactory::CreateSkeletalMaterials(TArray<FMaterialChunk> MaterialInfos)
+TArray<FSkeletalMaterial> UEFModelFactory::CreateSkeletalMaterials(TArray<FMaterialChunk> MaterialInfos, const FUEFNameTable& Names)
 {
 	TArray<FSkeletalMaterial> Materials;
 	for (const auto& MaterialInfo : MaterialInfos)
 	{
 		FSkeletalMaterial Material;
-		Material.MaterialSlotName = MaterialInfo.Name.c_str();
-		Material.ImportedMaterialSlotName = MaterialInfo.Name.c_str();
+		Material.MaterialSlotName = Names.Get(MaterialInfo.Name);
+		Material.ImportedMaterialSlotName = Names.Get(MaterialInfo.Name);
 		Material.MaterialInterface = nullptr;
 		Materials.Add(Material);
 	}
@@ -148,14 +217,146 @@ TArray<FSkeletalMaterial> UEFModelFactory::CreateSkeletalMaterials(TArray<FMater
 
 void UEFModelFactory::ProcessLOD(
 	FMeshDescription& MeshDesc,
-	FLODData& LODData)
+	FLODData& LODData,
+	const FUEFNameTable& Names)
 {
-	PopulateMeshDescription(MeshDesc, LODData);
-	SetMeshAttributes(MeshDesc, LODData);
-	CreatePolygonGroups(MeshDesc, LODData);
+	//Reverse lookups (vertex to instances, instance to triangles, ...) are built once at the end instead of being
+	//updated for every element. Edges stay indexed, CreateTriangle looks up existing edges through them.
+	MeshDesc.SuspendVertexInstanceIndexing();
+	MeshDesc.SuspendPolygonIndexing();
+	MeshDesc.SuspendUVIndexing();
+
+	FUEFVertexInstanceMap Instances;
+	PopulateMeshDescription(MeshDesc, LODData, Instances);
+	if (Instances.InstanceVertices.Num() < LODData.Indices.Num())
+		UE_LOG(LogTemp, Log, TEXT("Welded %d vertex instances into %d, %d saved"), LODData.Indices.Num(), Instances.InstanceVertices.Num(), LODData.Indices.Num() - Instances.InstanceVertices.Num());
+	SetMeshAttributes(MeshDesc, LODData, Instances);
+	CreatePolygonGroups(MeshDesc, LODData, Instances, Names);
+
+	MeshDesc.ResumeVertexInstanceIndexing();
+	MeshDesc.ResumePolygonIndexing();
+	MeshDesc.ResumeUVIndexing();
+	MeshDesc.BuildIndexers();
+}
+
+void UEFModelFactory::ProcessSkeletalLOD(
+	FMeshDescription& MeshDesc,
+	FLODData& Data,
+	const FReferenceSkeleton& RefSkeleton,
+	const FUEFNameTable& Names)
+{
+	//Skeletal Mesh Attributes
+	FSkeletalMeshAttributes SkeletalAttributes(MeshDesc);
+	SkeletalAttributes.Register();
+
+	FSkeletalMeshAttributes::FBoneNameAttributesRef BoneNames = SkeletalAttributes.GetBoneNames();
+	FSkeletalMeshAttributes::FBoneParentIndexAttributesRef BoneParentIndices = SkeletalAttributes.GetBoneParentIndices();
+	FSkeletalMeshAttributes::FBonePoseAttributesRef BonePoses = SkeletalAttributes.GetBonePoses();
+
+	//Bones
+	for (auto Index = 0; Index < RefSkeleton.GetRawBoneNum(); ++Index)
+	{
+		FMeshBoneInfo BoneInfo = RefSkeleton.GetRefBoneInfo()[Index];
+		FTransform BoneTransform = RefSkeleton.GetRefBonePose()[Index];
+
+		SkeletalAttributes.CreateBone();
+		BoneNames.Set(Index, BoneInfo.Name);
+		BoneParentIndices.Set(Index, BoneInfo.ParentIndex);
+		BonePoses.Set(Index, BoneTransform);
+	}
+
+	//Weights
+	//Capped to the engine's max influences and normalized per vertex by UEFLimitInfluences, then converted on worker
+	//threads. Setting the attribute writes into shared storage and stays on this thread.
+	FSkinWeightsVertexAttributesRef VertexWeights = SkeletalAttributes.GetVertexSkinWeights();
+
+	UE::AnimationCore::FBoneWeightsSettings WeightsSettings;
+	WeightsSettings.SetNormalizeType(UE::AnimationCore::EBoneWeightNormalizeType::Always);
+	WeightsSettings.SetMaxWeightCount(MAX_TOTAL_INFLUENCES);
+
+	FSkinWeightsData SkinWeights;
+	UEFLimitInfluences(Data, WeightsSettings.GetMaxWeightCount(), SkinWeights);
+	const int32 NumWeightedVertices = SkinWeights.NumVertices();
+
+	TArray<UE::AnimationCore::FBoneWeights> VertexBoneWeights;
+	VertexBoneWeights.SetNum(NumWeightedVertices);
+	ParallelFor(NumWeightedVertices, [&SkinWeights, &WeightsSettings, &VertexBoneWeights](int32 VertexIndex)
+	{
+		TConstArrayView<FWeightChunk> Weights = SkinWeights.GetVertexWeights(VertexIndex);
+		if (Weights.IsEmpty())
+			return;
+		TArray<UE::AnimationCore::FBoneWeight, TInlineAllocator<MAX_TOTAL_INFLUENCES>> BoneWeightsArray;
+		BoneWeightsArray.Reserve(Weights.Num());
+		for (const FWeightChunk& Weight : Weights)
+			BoneWeightsArray.Emplace(Weight.WeightBoneIndex, Weight.WeightAmount);
+		VertexBoneWeights[VertexIndex] = UE::AnimationCore::FBoneWeights::Create(BoneWeightsArray, WeightsSettings);
+	}, !ShouldDecodeInParallel(static_cast<int64>(SkinWeights.Num()) * sizeof(FWeightChunk)));
+
+	for (auto VertexIndex = 0; VertexIndex < NumWeightedVertices; VertexIndex++)
+	{
+		if (VertexBoneWeights[VertexIndex].Num() > 0)
+			VertexWeights.Set(VertexIndex, VertexBoneWeights[VertexIndex]);
+	}
+
+	//Morph Targets
+	//Pruned per morph on worker threads, then registered here since that changes the mesh description's attribute
+	//set. Every morph has an attribute array of its own, so the deltas are filled on worker threads again.
+	const float DeltaThreshold = CVarUEFormatMorphDeltaThreshold.GetValueOnAnyThread();
+	const bool bDropEmptyMorphs = CVarUEFormatDropEmptyMorphTargets.GetValueOnAnyThread();
+	const float DeltaThresholdSquared = FMath::Square(FMath::Max(DeltaThreshold, 0.0f));
+	const int32 NumVertices = Data.Vertices.Num();
+	int64 MorphBytes = 0;
+	for (const auto& MorphTarget : Data.Morphs)
+		MorphBytes += MorphTarget.MorphDeltas.Num() * static_cast<int64>(sizeof(FMorphTargetDataChunk));
+	const bool bMorphsSingleThread = !ShouldDecodeInParallel(MorphBytes);
+
+	TArray<FUEFMorphDeltas> Morphs;
+	Morphs.SetNum(Data.Morphs.Num());
+	ParallelFor(Data.Morphs.Num(), [&Data, &Names, &Morphs, DeltaThresholdSquared, NumVertices](int32 MorphIndex)
+	{
+		const FMorphTargetChunk& MorphTarget = Data.Morphs[MorphIndex];
+		FUEFMorphDeltas& Morph = Morphs[MorphIndex];
+		Morph.Name = Names.Get(MorphTarget.MorphName);
+		Morph.Vertices.Reserve(MorphTarget.MorphDeltas.Num());
+		Morph.Positions.Reserve(MorphTarget.MorphDeltas.Num());
+		for (const auto& MorphDelta : MorphTarget.MorphDeltas)
+		{
+			if (MorphDelta.MorphVertexIndex < 0 || MorphDelta.MorphVertexIndex >= NumVertices)
+				continue;
+			if (MorphDelta.MorphPosition.SizeSquared() <= DeltaThresholdSquared && MorphDelta.MorphNormals.SizeSquared() <= DeltaThresholdSquared)
+				continue;
+			Morph.Vertices.Add(MorphDelta.MorphVertexIndex);
+			Morph.Positions.Emplace(MorphDelta.MorphPosition.X, -MorphDelta.MorphPosition.Y, MorphDelta.MorphPosition.Z);
+		}
+	}, bMorphsSingleThread);
+
+	int64 NumDeltas = 0;
+	int64 NumKeptDeltas = 0;
+	TArray<int32> RegisteredMorphs;
+	TArray<TVertexAttributesRef<FVector3f>> MorphPositionDeltas;
+	for (auto MorphIndex = 0; MorphIndex < Morphs.Num(); MorphIndex++)
+	{
+		NumDeltas += Data.Morphs[MorphIndex].MorphDeltas.Num();
+		NumKeptDeltas += Morphs[MorphIndex].Vertices.Num();
+		if (bDropEmptyMorphs && Morphs[MorphIndex].Vertices.IsEmpty())
+			continue;
+		SkeletalAttributes.RegisterMorphTargetAttribute(Morphs[MorphIndex].Name, false);
+		RegisteredMorphs.Add(MorphIndex);
+		MorphPositionDeltas.Add(SkeletalAttributes.GetVertexMorphPositionDelta(Morphs[MorphIndex].Name));
+	}
+	if (NumKeptDeltas < NumDeltas)
+		UE_LOG(LogTemp, Log, TEXT("Pruned %lld of %lld morph target deltas, %d of %d morph targets kept"), NumDeltas - NumKeptDeltas, NumDeltas, RegisteredMorphs.Num(), Morphs.Num());
+
+	ParallelFor(RegisteredMorphs.Num(), [&Morphs, &RegisteredMorphs, &MorphPositionDeltas](int32 Index)
+	{
+		const FUEFMorphDeltas& Morph = Morphs[RegisteredMorphs[Index]];
+		TVertexAttributesRef<FVector3f>& PositionDeltas = MorphPositionDeltas[Index];
+		for (auto DeltaIndex = 0; DeltaIndex < Morph.Vertices.Num(); DeltaIndex++)
+			PositionDeltas.Set(Morph.Vertices[DeltaIndex], Morph.Positions[DeltaIndex]);
+	}, bMorphsSingleThread);
 }
 
-UStaticMesh* UEFModelFactory::CreateStaticMesh(TArray<FLODData>& LODData, UObject* Parent, FName Name, EObjectFlags Flags) {
+UStaticMesh* UEFModelFactory::CreateStaticMesh(TArray<FLODData>& LODData, const FUEFNameTable& Names, UObject* Parent, FName Name, EObjectFlags Flags) {
 	UStaticMesh* StaticMesh = NewObject<UStaticMesh>(Parent->GetPackage(), Name, Flags);
 	
 	//Mesh Descriptions
@@ -165,16 +366,19 @@ UStaticMesh* UEFModelFactory::CreateStaticMesh(TArray<FLODData>& LODData, UObjec
 	TArray<const FMeshDescription*> MeshDescriptionPtrs;
 	MeshDescriptionPtrs.Reserve(LODData.Num());
 	
-	for (auto i = 0; i < LODData.Num(); ++i) {
-		MeshDescriptions.Emplace(); //Modify the array outside of the loop
+	MeshDescriptions.SetNum(LODData.Num()); //Sized up front, the LODs below are built concurrently
+	for (auto i = 0; i < LODData.Num(); ++i)
 		MeshDescriptionPtrs.Add(&MeshDescriptions[i]); //Get the pointer and add it to the pointer array
-		ProcessLOD(MeshDescriptions[i], LODData[i]);
-	}
+
+	ParallelFor(LODData.Num(), [this, &MeshDescriptions, &LODData, &Names](int32 LodIndex)
+	{
+		ProcessLOD(MeshDescriptions[LodIndex], LODData[LodIndex], Names);
+	}, !ShouldProcessLODsInParallel(LODData));
 
 	StaticMesh->PostEditChange();
 	UStaticMesh::FBuildMeshDescriptionsParams BuildParams;
 	StaticMesh->BuildFromMeshDescriptions(MeshDescriptionPtrs, BuildParams);
-	StaticMesh->GetStaticMaterials() = CreateStaticMaterials(LODData[0].Materials);
+	StaticMesh->GetStaticMaterials() = CreateStaticMaterials(LODData[0].Materials, Names);
 	
 	//Mesh LOD Settings
 	for (auto i = 0; i < StaticMesh->GetSourceModels().Num(); ++i)
@@ -190,13 +394,13 @@ UStaticMesh* UEFModelFactory::CreateStaticMesh(TArray<FLODData>& LODData, UObjec
 	return StaticMesh;
 }
 
-USkeletalMesh* UEFModelFactory::CreateSkeletalMesh(TArray<FLODData>& LODData, FSkeletonData& SkeletonData, UObject* Parent, FName Name, EObjectFlags Flags)
+USkeletalMesh* UEFModelFactory::CreateSkeletalMesh(TArray<FLODData>& LODData, FSkeletonData& SkeletonData, const FUEFNameTable& Names, UObject* Parent, FName Name, EObjectFlags Flags)
 {
 	USkeletalMesh* SkeletalMesh = NewObject<USkeletalMesh>(Parent->GetPackage(), Name, Flags);
 
 	//Skeleton
 	FReferenceSkeleton RefSkeleton;
-	USkeleton* Skeleton = CreateSkeleton(Name.ToString(), Parent, Flags, SkeletonData, RefSkeleton);
+	USkeleton* Skeleton = CreateSkeleton(Name.ToString(), Parent, Flags, SkeletonData, Names, RefSkeleton);
 	
 	//Mesh Descriptions
 	TArray<FMeshDescription> MeshDescriptions;
@@ -205,61 +409,17 @@ USkeletalMesh* UEFModelFactory::CreateSkeletalMesh(TArray<FLODData>& LODData, FS
 	TArray<const FMeshDescription*> MeshDescriptionPtrs;
 	MeshDescriptionPtrs.Reserve(LODData.Num());
 
+	MeshDescriptions.SetNum(LODData.Num()); //Sized up front, the LODs below are built concurrently
 	for (auto LodIndex = 0; LodIndex < LODData.Num(); ++LodIndex)
-	{
-		FLODData& Data = LODData[LodIndex];
-		MeshDescriptions.Emplace(); //Modify the array outside of the loop
 		MeshDescriptionPtrs.Add(&MeshDescriptions[LodIndex]); //Get the pointer and add it to the pointer array
-		ProcessLOD(MeshDescriptions[LodIndex], Data);
-
-		//Skeletal Mesh Attributes
-		FSkeletalMeshAttributes SkeletalAttributes(MeshDescriptions[LodIndex]);
-		SkeletalAttributes.Register();
-
-		FSkeletalMeshAttributes::FBoneNameAttributesRef BoneNames = SkeletalAttributes.GetBoneNames();
-		FSkeletalMeshAttributes::FBoneParentIndexAttributesRef BoneParentIndices = SkeletalAttributes.GetBoneParentIndices();
-		FSkeletalMeshAttributes::FBonePoseAttributesRef BonePoses = SkeletalAttributes.GetBonePoses();
-
-		//Bones
-		for (auto Index = 0; Index < RefSkeleton.GetRawBoneNum(); ++Index)
-		{
-			FMeshBoneInfo BoneInfo = RefSkeleton.GetRefBoneInfo()[Index];
-			FTransform BoneTransform = RefSkeleton.GetRefBonePose()[Index];
-
-			SkeletalAttributes.CreateBone();
-			BoneNames.Set(Index, BoneInfo.Name);
-			BoneParentIndices.Set(Index, BoneInfo.ParentIndex);
-			BonePoses.Set(Index, BoneTransform);
-		}
-
-		//Weights
-		FSkinWeightsVertexAttributesRef VertexWeights = SkeletalAttributes.GetVertexSkinWeights();
 
-		TMap<int32, TArray<FWeightChunk>> VertexBoneWeights;
-		for (const auto& Weight : Data.Weights)
-			VertexBoneWeights.FindOrAdd(Weight.WeightVertexIndex).Emplace(Weight);
-
-		for (const auto& [VertexIndex, Weights] : VertexBoneWeights)
-		{
-			TArray<UE::AnimationCore::FBoneWeight> BoneWeightsArray;
-			BoneWeightsArray.Reserve(Weights.Num());
-			for (const auto& Weight : Weights)
-				BoneWeightsArray.Emplace(Weight.WeightBoneIndex, Weight.WeightAmount);
-			VertexWeights.Set(VertexIndex, UE::AnimationCore::FBoneWeights::Create(BoneWeightsArray));
-		}
-
-		//Morpth Targets
-		for (const auto& MorphTarget : Data.Morphs)
-		{
-			FString MorphName = MorphTarget.MorphName.c_str();
-			SkeletalAttributes.RegisterMorphTargetAttribute(*MorphName, false);
-			TVertexAttributesRef<FVector3f> OriginalVertexMorphPositionDelta = SkeletalAttributes.GetVertexMorphPositionDelta(*MorphName);
-			for (const auto& MorphDelta : MorphTarget.MorphDeltas)
-				OriginalVertexMorphPositionDelta.Set(MorphDelta.MorphVertexIndex, FVector3f(MorphDelta.MorphPosition.X, -MorphDelta.MorphPosition.Y, MorphDelta.MorphPosition.Z));
-		}
-	}
+	ParallelFor(LODData.Num(), [this, &MeshDescriptions, &LODData, &RefSkeleton, &Names](int32 LodIndex)
+	{
+		ProcessLOD(MeshDescriptions[LodIndex], LODData[LodIndex], Names);
+		ProcessSkeletalLOD(MeshDescriptions[LodIndex], LODData[LodIndex], RefSkeleton, Names);
+	}, !ShouldProcessLODsInParallel(LODData));
 	
-	TArray<FSkeletalMaterial> SkeletalMaterials = CreateSkeletalMaterials(LODData[0].Materials);
+	TArray<FSkeletalMaterial> SkeletalMaterials = CreateSkeletalMaterials(LODData[0].Materials, Names);
 	SkeletalMesh->GetMaterials() = SkeletalMaterials;
 
     FStaticToSkeletalMeshConverter::InitializeSkeletalMeshFromMeshDescriptions(SkeletalMesh, MeshDescriptionPtrs, SkeletalMaterials, RefSkeleton, false, false);
@@ -274,7 +434,7 @@ USkeletalMesh* UEFModelFactory::CreateSkeletalMesh(TArray<FLODData>& LODData, FS
     return SkeletalMesh;
 }
 
-USkeleton* UEFModelFactory::CreateSkeleton(FString Name, UObject* Parent, EObjectFlags Flags, FSkeletonData& Data, FReferenceSkeleton& RefSkeleton)
+USkeleton* UEFModelFactory::CreateSkeleton(FString Name, UObject* Parent, EObjectFlags Flags, FSkeletonData& Data, const FUEFNameTable& Names, FReferenceSkeleton& RefSkeleton)
 {
 	FString SkeletonName = Name + "_Skeleton";
 	auto SkeletonPackage = CreatePackage(*FPaths::Combine(FPaths::GetPath(Parent->GetPathName()), SkeletonName));
@@ -290,15 +450,16 @@ USkeleton* UEFModelFactory::CreateSkeleton(FString Name, UObject* Parent, EObjec
 		Transform.SetRotation(FQuat(Bone.BoneRot));
 		Transform.SetScale3D(FVector(1, 1, 1));
 
-		FMeshBoneInfo BoneInfo(Bone.BoneName.c_str(), Bone.BoneName.c_str(), Bone.BoneParentIndex);
+		const FName BoneName = Names.Get(Bone.BoneName);
+		FMeshBoneInfo BoneInfo(BoneName, BoneName.ToString(), Bone.BoneParentIndex);
 		RefSkeletonModifier.Add(BoneInfo, FTransform(Transform));
 	}
 
 	for (const auto& Socket : Data.Sockets)
 	{
 		USkeletalMeshSocket* NewSocket = NewObject<USkeletalMeshSocket>(Skeleton);
-		NewSocket->SocketName = Socket.SocketName.c_str();
-		NewSocket->BoneName = Socket.SocketParentName.c_str();
+		NewSocket->SocketName = Names.Get(Socket.SocketName);
+		NewSocket->BoneName = Names.Get(Socket.SocketParentName);
 		NewSocket->RelativeLocation = FVector(Socket.SocketPos);
 		NewSocket->RelativeRotation = FQuat(Socket.SocketRot).Rotator();
 		NewSocket->RelativeScale = FVector(Socket.SocketScale);
@@ -306,7 +467,7 @@ USkeleton* UEFModelFactory::CreateSkeleton(FString Name, UObject* Parent, EObjec
 	}
 
 	for (const auto& VirtualBone : Data.VirtualBones)
-		Skeleton->AddNewNamedVirtualBone(VirtualBone.SourceBoneName.c_str(), VirtualBone.TargetBoneName.c_str(), VirtualBone.VirtualBoneName.c_str());
+		Skeleton->AddNewNamedVirtualBone(Names.Get(VirtualBone.SourceBoneName), Names.Get(VirtualBone.TargetBoneName), Names.Get(VirtualBone.VirtualBoneName));
 	
 	return Skeleton;
 }
\ No newline at end of file
@@ -0,0 +1,48 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#include "Factories/UEFSkinWeights.h"
+#include "Async/ParallelFor.h"
+
+void UEFLimitInfluences(const FLODData& Data, int32 MaxInfluences, FSkinWeightsData& OutWeights)
+{
+	const FSkinWeightsData& Weights = Data.Weights;
+	const int32 NumVertices = FMath::Min(Weights.NumVertices(), Data.Vertices.Num());
+	OutWeights.Offsets.Reset();
+	OutWeights.Weights.Reset();
+	if (NumVertices == 0)
+		return;
+
+	// Sized first, so every vertex is then filled on its own task
+	OutWeights.Offsets.SetNumUninitialized(NumVertices + 1);
+	OutWeights.Offsets[0] = 0;
+	for (auto VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+	{
+		int32 NumPositive = 0;
+		for (const FWeightChunk& Weight : Weights.GetVertexWeights(VertexIndex))
+			NumPositive += Weight.WeightAmount > 0.0f ? 1 : 0;
+		OutWeights.Offsets[VertexIndex + 1] = OutWeights.Offsets[VertexIndex] + FMath::Min(NumPositive, MaxInfluences);
+	}
+	OutWeights.Weights.SetNumUninitialized(OutWeights.Offsets[NumVertices]);
+
+	ParallelFor(NumVertices, [&Weights, &OutWeights](int32 VertexIndex)
+	{
+		FWeightChunk* Out = OutWeights.Weights.GetData() + OutWeights.Offsets[VertexIndex];
+		const int32 NumKept = OutWeights.Offsets[VertexIndex + 1] - OutWeights.Offsets[VertexIndex];
+		if (NumKept == 0)
+			return;
+
+		TArray<FWeightChunk, TInlineAllocator<16>> Sorted;
+		for (const FWeightChunk& Weight : Weights.GetVertexWeights(VertexIndex))
+		{
+			if (Weight.WeightAmount > 0.0f)
+				Sorted.Add(Weight);
+		}
+		Sorted.StableSort([](const FWeightChunk& A, const FWeightChunk& B) { return A.WeightAmount > B.WeightAmount; });
+
+		float Sum = 0.0f;
+		for (auto Index = 0; Index < NumKept; Index++)
+			Sum += Sorted[Index].WeightAmount;
+		for (auto Index = 0; Index < NumKept; Index++)
+			Out[Index] = FWeightChunk{ Sorted[Index].WeightBoneIndex, Sorted[Index].WeightAmount / Sum };
+	}, !ShouldDecodeInParallel(static_cast<int64>(Weights.Num()) * sizeof(FWeightChunk)));
+}
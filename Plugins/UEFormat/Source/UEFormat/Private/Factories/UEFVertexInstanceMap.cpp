@@ -0,0 +1,27 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#include "Factories/UEFVertexInstanceMap.h"
+
+void FUEFVertexInstanceMap::Build(const FLODData& Data, bool bWeld)
+{
+	IndexInstances.Reset();
+	WeldedVertices.Reset();
+	if (!bWeld)
+	{
+		InstanceVertices = Data.Indices.AsView();
+		return;
+	}
+
+	TArray<int32> VertexInstances;
+	VertexInstances.Init(INDEX_NONE, Data.Vertices.Num());
+	IndexInstances.SetNumUninitialized(Data.Indices.Num());
+	WeldedVertices.Reserve(Data.Vertices.Num());
+	for (auto i = 0; i < Data.Indices.Num(); i++)
+	{
+		int32& Instance = VertexInstances[Data.Indices[i]];
+		if (Instance == INDEX_NONE)
+			Instance = WeldedVertices.Add(Data.Indices[i]);
+		IndexInstances[i] = Instance;
+	}
+	InstanceVertices = WeldedVertices;
+}
@@ -2,138 +2,270 @@
 
 #include "Readers/UEFAnimReader.h"
 #include "Readers/UEFModelReader.h"
-#include "Misc/Compression.h"
+#include "UEFQuatKernels.h"
+#include "Async/ParallelFor.h"
 #include <string>
-#include "zstd.h"
-#include <vector>
 
-UEFAnimReader::UEFAnimReader(const FString Filename) {
-	Ar.open(ToCStr(Filename), std::ios::binary);
-}
+UEFAnimReader::UEFAnimReader(const FString Filename, EUEFSourceMode Mode) : Source(Filename, Mode) {}
 
 UEFAnimReader::~UEFAnimReader() { //Destructor
-	if (Ar.is_open()) {
-		Ar.close();
-	}
+	Source.Close();
 }
 
-bool UEFAnimReader::Read() {
-	const std::string Magic = ReadString(Ar, GMAGIC.length());
-	if (Magic != GMAGIC) return false;
-
-	Header.Identifier = ReadFString(Ar);
-	Header.FileVersionBytes = ReadData<std::byte>(Ar);
-	Header.ObjectName = ReadFString(Ar);
-	Header.IsCompressed = ReadData<bool>(Ar);
-
-	if (Header.IsCompressed) {
-		Header.CompressionType = ReadFString(Ar);
-		Header.UncompressedSize = ReadData<int32>(Ar);
-		Header.CompressedSize = ReadData<int32>(Ar);
-
-		std::vector<char> CompressedBuffer(Header.CompressedSize);
-		Ar.read(CompressedBuffer.data(), Header.CompressedSize);
-		if (Ar.fail()) {
-			UE_LOG(LogTemp, Error, TEXT("Error reading compressed data."));
-			return false;
-		}
+FUEFReadResult UEFAnimReader::Read() {
+	if (FUEFReadResult Result = Source.ReadHeader(GMAGIC, Header); Result.HasError()) return Result;
+	if (FUEFReadResult Result = Source.ReadPayload(Header); Result.HasError()) return Result;
 
-		std::vector<char> UncompressedBuffer(Header.UncompressedSize);
+	if (FUEFZstdStream* Stream = Source.GetStream())
+	{
+		ReadStream(*Stream);
+		TOptional<FUEFReadError> StreamError = MoveTemp(Stream->GetError());
+		Source.Close();
+		if (StreamError.IsSet())
+			return MakeError(MoveTemp(StreamError.GetValue()));
+		return MakeValue();
+	}
 
-		if (Header.CompressionType == "ZSTD")
-			ZSTD_decompress(UncompressedBuffer.data(), Header.UncompressedSize, CompressedBuffer.data(), Header.CompressedSize);
+	TOptional<FUEFReadError> Error;
+	FUEFBufferCursor Cursor(Source.GetPayload(), Source.GetPayloadSize(), Error);
+	ReadBuffer(Cursor);
 
-		else if (Header.CompressionType == "GZIP")
-			FCompression::UncompressMemory(NAME_Gzip, UncompressedBuffer.data(), Header.UncompressedSize, CompressedBuffer.data(), Header.CompressedSize);
+	Source.Close();
+	if (Error.IsSet())
+		return MakeError(MoveTemp(Error.GetValue()));
+	return MakeValue();
+}
 
-		ReadBuffer(UncompressedBuffer.data(), Header.UncompressedSize);
-	}
-	else {
-		const auto CurrentPos = Ar.tellg();
-		Ar.seekg(0, std::ios::end);
-		const auto RemainingSize = Ar.tellg() - CurrentPos;
-		Ar.seekg(CurrentPos, std::ios::beg);
-        
-		std::vector<char> UncompressedBuffer(RemainingSize);
-		Ar.read(UncompressedBuffer.data(), RemainingSize);
-		if (Ar.fail()) {
-			UE_LOG(LogTemp, Error, TEXT("Error reading uncompressed data."));
-			return false;
+// Keys are packed as an int32 frame followed by the value, in position, rotation, scale order per track
+static constexpr int32 PackedVectorKeySize = sizeof(int32) + sizeof(FVector3f);
+static constexpr int32 PackedQuatKeySize = sizeof(int32) + sizeof(FQuat4f);
+static constexpr int32 PackedFloatKeySize = sizeof(int32) + sizeof(float);
+
+namespace
+{
+	struct FTrackKeyCounts
+	{
+		int32 Pos = 0;
+		int32 Rot = 0;
+		int32 Scale = 0;
+	};
+
+	// Hands out consecutive ranges of a key block. Quaternions go first so they start on the block's 16 byte alignment.
+	struct FKeyBlockCarver
+	{
+		uint8* Next;
+
+		template<typename T>
+		TArrayView<T> Take(int32 Num)
+		{
+			T* Result = reinterpret_cast<T*>(Next);
+			Next += static_cast<int64>(Num) * sizeof(T);
+			return MakeArrayView(Result, Num);
 		}
+	};
 
-		ReadBuffer(UncompressedBuffer.data(), RemainingSize);
+	// Reads a key count and steps over the keys, returns the count
+	int32 SkipKeys(FUEFBufferCursor& Cursor, int32 PackedSize)
+	{
+		const int32 Num = ReadBufferData<int32>(Cursor);
+		if (Cursor.RequireCount(Num, PackedSize))
+			Cursor.Consume(static_cast<int64>(Num) * PackedSize);
+		return Num;
 	}
 
-	Ar.close();
-	return true;
+	// Splits packed frame + value keys into the two streams
+	template<typename T>
+	void ReadKeys(FUEFBufferCursor& Cursor, TUEFKeyStream<T>& Keys)
+	{
+		constexpr int32 PackedSize = sizeof(int32) + sizeof(T);
+		const int32 Num = ReadBufferData<int32>(Cursor);
+		const char* Src = Cursor.RequireCount(Num, PackedSize) ? Cursor.Consume(static_cast<int64>(Num) * PackedSize) : nullptr;
+		if (!Src)
+			return;
+		if (Num != Keys.Num())
+		{
+			Cursor.SetError(TEXT("key count differs from the pre-scan"));
+			return;
+		}
+		for (int32 i = 0; i < Num; i++, Src += PackedSize)
+		{
+			std::memcpy(&Keys.Frames[i], Src, sizeof(int32));
+			std::memcpy(&Keys.Values[i], Src + sizeof(int32), sizeof(T));
+		}
+	}
 }
 
-void UEFAnimReader::ReadBuffer(const char* Buffer, int32 BufferSize)
+void UEFAnimReader::ReadBuffer(FUEFBufferCursor& Cursor)
 {
-	int32 Offset = 0;
+	while (!Cursor.IsAtEnd() && !Cursor.IsError())
+	{
+		std::string ChunkName = ReadBufferFString(Cursor);
+		int32 ArraySize = ReadBufferData<int32>(Cursor);
+		int32 ByteSize = ReadBufferData<int32>(Cursor);
+		FUEFBufferCursor Chunk = Cursor.Slice(ByteSize, ChunkName);
+		ReadChunk(ChunkName, ArraySize, Chunk);
+	}
+}
 
-	while (Offset < BufferSize)
+void UEFAnimReader::ReadStream(FUEFZstdStream& Stream)
+{
+	// Every chunk is parsed as soon as it has been decompressed, unknown ones are skipped without buffering them
+	while (!Stream.IsAtEnd())
 	{
-		std::string ChunkName = ReadBufferFString(Buffer, Offset);
-		int32 ArraySize = ReadBufferData<int32>(Buffer, Offset);
-		int32 ByteSize = ReadBufferData<int32>(Buffer, Offset);
-		if (ChunkName == "METADATA")
+		std::string ChunkName = Stream.ReadFString();
+		int32 ArraySize = Stream.Read<int32>();
+		int32 ByteSize = Stream.Read<int32>();
+		if (ChunkName == "METADATA" || ChunkName == "TRACKS" || ChunkName == "CURVES")
 		{
-			NumFrames = ReadBufferData<int32>(Buffer, Offset);
-			FramesPerSecond = ReadBufferData<float>(Buffer, Offset);
-			RefPosePath = ReadBufferFString(Buffer, Offset);
-			AdditiveAnimType = static_cast<EAdditiveAnimationType>(ReadBufferData<uint8>(Buffer, Offset));
-			RefPoseType = static_cast<EAdditiveBasePoseType>(ReadBufferData<uint8>(Buffer, Offset));
-			RefFrameIndex = ReadBufferData<int32>(Buffer, Offset);
+			FUEFBufferCursor Chunk = Stream.ReadSlice(ByteSize, ChunkName);
+			ReadChunk(ChunkName, ArraySize, Chunk);
 		}
-		else if (ChunkName == "TRACKS")
-		{
-			Tracks.SetNum(ArraySize);
-			for (auto i = 0; i < ArraySize; i++)
-			{
-				Tracks[i].TrackName = ReadBufferFString(Buffer, Offset);
+		else
+			Stream.Skip(ByteSize);
+	}
+}
 
-				const int32 PosArraySize = ReadBufferData<int32>(Buffer, Offset);
-				Tracks[i].TrackPosKeys.SetNum(PosArraySize);
-				for (auto j = 0; j < PosArraySize; j++)
-				{
-					Tracks[i].TrackPosKeys[j].Frame = ReadBufferData<int32>(Buffer, Offset);
-					Tracks[i].TrackPosKeys[j].VectorValue = ReadBufferData<FVector3f>(Buffer, Offset);
-				}
+void UEFAnimReader::ReadChunk(const std::string& ChunkName, int32 ArraySize, FUEFBufferCursor& Chunk)
+{
+	if (ChunkName == "METADATA")
+	{
+		NumFrames = ReadBufferData<int32>(Chunk);
+		FramesPerSecond = ReadBufferData<float>(Chunk);
+		RefPosePath = ReadBufferStringView(Chunk, Arena);
+		AdditiveAnimType = static_cast<EAdditiveAnimationType>(ReadBufferData<uint8>(Chunk));
+		RefPoseType = static_cast<EAdditiveBasePoseType>(ReadBufferData<uint8>(Chunk));
+		RefFrameIndex = ReadBufferData<int32>(Chunk);
+		if (NumFrames < 0)
+			Chunk.SetError(TEXT("negative frame count"));
+	}
+	else if (ChunkName == "TRACKS")
+	{
+		// Name length plus three key counts
+		if (!Chunk.RequireCount(ArraySize, 16))
+			return;
 
-				const int32 RotArraySize = ReadBufferData<int32>(Buffer, Offset);
-				Tracks[i].TrackRotKeys.SetNum(RotArraySize);
-				for (auto k = 0; k < RotArraySize; k++)
-				{
-					Tracks[i].TrackRotKeys[k].Frame = ReadBufferData<int32>(Buffer, Offset);
-					Tracks[i].TrackRotKeys[k].QuatValue = ReadBufferQuat(Buffer, Offset);
-				}
+		// A track's size is only known after reading its key counts, so walk the counts first and slice every
+		// track out. The slices are fully validated and can be decoded independently.
+		TArray<FUEFBufferCursor> TrackCursors;
+		TArray<FTrackKeyCounts> TrackCounts;
+		TrackCursors.Reserve(ArraySize);
+		TrackCounts.Reserve(ArraySize);
+		FTrackKeyCounts Total;
+		const int32 TracksStart = Chunk.GetOffset();
+		for (auto i = 0; i < ArraySize && !Chunk.IsError(); i++)
+		{
+			FUEFBufferCursor Scan = Chunk;
+			const std::string TrackName = ReadBufferFString(Scan);
+			FTrackKeyCounts& Counts = TrackCounts.Emplace_GetRef();
+			Counts.Pos = SkipKeys(Scan, PackedVectorKeySize);
+			Counts.Rot = SkipKeys(Scan, PackedQuatKeySize);
+			Counts.Scale = SkipKeys(Scan, PackedVectorKeySize);
+			if (Scan.IsError())
+				return;
+			Total.Pos += Counts.Pos;
+			Total.Rot += Counts.Rot;
+			Total.Scale += Counts.Scale;
+			TrackCursors.Add(Chunk.Slice(Scan.GetOffset() - Chunk.GetOffset(), TrackName));
+		}
 
-				const int32 ScaleArraySize = ReadBufferData<int32>(Buffer, Offset);
-				Tracks[i].TrackScaleKeys.SetNum(ScaleArraySize);
-				for (auto l = 0; l < ScaleArraySize; l++)
-				{
-					Tracks[i].TrackScaleKeys[l].Frame = ReadBufferData<int32>(Buffer, Offset);
-					Tracks[i].TrackScaleKeys[l].VectorValue = ReadBufferData<FVector3f>(Buffer, Offset);
-				}
-			}
+		// Every track's streams are carved out of one block, all values of a kind end up adjacent
+		const int64 NumKeys = static_cast<int64>(Total.Pos) + Total.Rot + Total.Scale;
+		const int64 BlockSize = Total.Rot * sizeof(FQuat4f) + (Total.Pos + Total.Scale) * sizeof(FVector3f) + NumKeys * sizeof(int32);
+		FKeyBlockCarver Carver{ static_cast<uint8*>(Arena.Allocate(BlockSize, 16)) };
+		Tracks.SetNum(ArraySize);
+		for (auto i = 0; i < ArraySize; i++)
+			Tracks[i].RotKeys.Values = Carver.Take<FQuat4f>(TrackCounts[i].Rot);
+		for (auto i = 0; i < ArraySize; i++)
+		{
+			Tracks[i].PosKeys.Values = Carver.Take<FVector3f>(TrackCounts[i].Pos);
+			Tracks[i].ScaleKeys.Values = Carver.Take<FVector3f>(TrackCounts[i].Scale);
+		}
+		for (auto i = 0; i < ArraySize; i++)
+		{
+			Tracks[i].PosKeys.Frames = Carver.Take<int32>(TrackCounts[i].Pos);
+			Tracks[i].RotKeys.Frames = Carver.Take<int32>(TrackCounts[i].Rot);
+			Tracks[i].ScaleKeys.Frames = Carver.Take<int32>(TrackCounts[i].Scale);
 		}
-		else if (ChunkName == "CURVES")
+
+		if (TrackCursors.Num() > 1 && ShouldDecodeInParallel(Chunk.GetOffset() - TracksStart))
 		{
-			Curves.SetNum(ArraySize);
-			for (auto i = 0; i < ArraySize; i++)
+			// Per-track errors, the earliest track's error is reported so the result does not depend on scheduling
+			TArray<TOptional<FUEFReadError>> Errors;
+			Errors.SetNum(TrackCursors.Num());
+			ParallelFor(TrackCursors.Num(), [this, &TrackCursors, &Errors](int32 Index) {
+				FUEFBufferCursor Track = TrackCursors[Index].WithError(Errors[Index]);
+				ReadTrack(Track, Tracks[Index]);
+			});
+			for (const TOptional<FUEFReadError>& Error : Errors)
 			{
-				Curves[i].CurveName = ReadBufferFString(Buffer, Offset);
-				const int32 KeyArraySize = ReadBufferData<int32>(Buffer, Offset);
-				Curves[i].CurveKeys.SetNum(KeyArraySize);
-				for (auto j = 0; j < KeyArraySize; j++)
+				if (Error.IsSet())
 				{
-					Curves[i].CurveKeys[j].Frame = ReadBufferData<int32>(Buffer, Offset);
-					Curves[i].CurveKeys[j].FloatValue = ReadBufferData<float>(Buffer, Offset);
+					Chunk.SetError(Error.GetValue());
+					return;
 				}
 			}
 		}
 		else
-			Offset += ByteSize;
+		{
+			for (auto i = 0; i < TrackCursors.Num() && !Chunk.IsError(); i++)
+				ReadTrack(TrackCursors[i], Tracks[i]);
+		}
 	}
+	else if (ChunkName == "CURVES")
+	{
+		if (!Chunk.RequireCount(ArraySize, 8))
+			return;
+
+		// Same pre-scan as tracks, only to size the key block
+		TArray<int32> KeyCounts;
+		KeyCounts.Reserve(ArraySize);
+		int64 TotalKeys = 0;
+		FUEFBufferCursor Scan = Chunk;
+		for (auto i = 0; i < ArraySize && !Scan.IsError(); i++)
+		{
+			Scan.Consume(ReadBufferData<int32>(Scan));
+			const int32 KeyArraySize = SkipKeys(Scan, PackedFloatKeySize);
+			KeyCounts.Add(KeyArraySize);
+			TotalKeys += KeyArraySize;
+		}
+		if (Scan.IsError())
+			return;
+
+		FKeyBlockCarver Carver{ static_cast<uint8*>(Arena.Allocate(TotalKeys * (sizeof(float) + sizeof(int32)), alignof(float))) };
+		Curves.SetNum(ArraySize);
+		for (auto i = 0; i < ArraySize; i++)
+			Curves[i].Keys.Values = Carver.Take<float>(KeyCounts[i]);
+		for (auto i = 0; i < ArraySize; i++)
+			Curves[i].Keys.Frames = Carver.Take<int32>(KeyCounts[i]);
+
+		for (auto i = 0; i < ArraySize && !Chunk.IsError(); i++)
+		{
+			Curves[i].CurveName = ReadBufferName(Chunk, Names);
+			ReadKeys(Chunk, Curves[i].Keys);
+		}
+	}
+}
+
+void UEFAnimReader::ReadTrack(FUEFBufferCursor& Cursor, FTrack& Track)
+{
+	Track.TrackName = ReadBufferName(Cursor, Names);
+
+	ReadKeys(Cursor, Track.PosKeys);
+
+	// Rotation keys are decoded and normalized in batches
+	const int32 RotArraySize = ReadBufferData<int32>(Cursor);
+	const char* Src = Cursor.RequireCount(RotArraySize, PackedQuatKeySize) ? Cursor.Consume(static_cast<int64>(RotArraySize) * PackedQuatKeySize) : nullptr;
+	if (!Src)
+		return;
+	if (RotArraySize != Track.RotKeys.Num())
+	{
+		Cursor.SetError(TEXT("key count differs from the pre-scan"));
+		return;
+	}
+	for (auto k = 0; k < RotArraySize; k++)
+		std::memcpy(&Track.RotKeys.Frames[k], Src + k * PackedQuatKeySize, sizeof(int32));
+	if (RotArraySize > 0)
+		UEFDecodeNormalizedQuats(Src + sizeof(int32), PackedQuatKeySize, Track.RotKeys.Values.GetData(), sizeof(FQuat4f), RotArraySize);
+
+	ReadKeys(Cursor, Track.ScaleKeys);
 }
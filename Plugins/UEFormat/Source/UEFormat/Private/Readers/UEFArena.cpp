@@ -0,0 +1,72 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#include "Readers/UEFArena.h"
+#include "Misc/ScopeLock.h"
+
+// Every block starts on this alignment, enough for any vector type the readers store
+static constexpr int32 BlockAlignment = 16;
+
+FUEFArena::FUEFArena(int64 InBlockSize) : BlockSize(InBlockSize) {}
+
+FUEFArena::~FUEFArena() { //Destructor
+	Reset();
+}
+
+void* FUEFArena::Allocate(int64 Size, int32 Alignment)
+{
+	if (Size <= 0)
+		return nullptr;
+	check(Alignment > 0 && Alignment <= BlockAlignment && FMath::IsPowerOfTwo(Alignment));
+
+	FScopeLock ScopeLock(&Lock);
+	uint8* Result = Align(Next, Alignment);
+	if (Next && Result + Size <= End)
+	{
+		Next = Result + Size;
+		return Result;
+	}
+
+	// Large arrays get a block of their own so the current block can still be filled with small allocations
+	if (Size > BlockSize / 4)
+	{
+		uint8* Block = static_cast<uint8*>(FMemory::Malloc(Size, BlockAlignment));
+		Blocks.Add(Block);
+		AllocatedSize += Size;
+		return Block;
+	}
+
+	Next = static_cast<uint8*>(FMemory::Malloc(BlockSize, BlockAlignment));
+	End = Next + BlockSize;
+	Blocks.Add(Next);
+	AllocatedSize += BlockSize;
+
+	Result = Next;
+	Next += Size;
+	return Result;
+}
+
+FAnsiStringView FUEFArena::CopyString(const char* Data, int32 Len)
+{
+	if (Len <= 0)
+		return FAnsiStringView();
+	char* Copy = AllocateArray<char>(Len);
+	FMemory::Memcpy(Copy, Data, Len);
+	return FAnsiStringView(Copy, Len);
+}
+
+void FUEFArena::Reset()
+{
+	FScopeLock ScopeLock(&Lock);
+	for (uint8* Block : Blocks)
+		FMemory::Free(Block);
+	Blocks.Empty();
+	Next = nullptr;
+	End = nullptr;
+	AllocatedSize = 0;
+}
+
+int64 FUEFArena::GetAllocatedSize() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return AllocatedSize;
+}
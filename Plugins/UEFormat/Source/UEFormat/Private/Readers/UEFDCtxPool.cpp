@@ -0,0 +1,82 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#include "Readers/UEFDCtxPool.h"
+#include "UEFormat.h"
+#include "Misc/ScopeLock.h"
+#include "zstd.h"
+
+FUEFDCtxPool::FScopedContext::FScopedContext(TSharedPtr<FUEFDCtxPool> InPool) : Pool(MoveTemp(InPool))
+{
+	Context = Pool.IsValid() ? Pool->Pop() : ZSTD_createDCtx();
+}
+
+FUEFDCtxPool::FScopedContext::~FScopedContext() { //Destructor
+	if (Pool.IsValid())
+		Pool->Push(Context);
+	else
+		ZSTD_freeDCtx(Context);
+}
+
+FUEFDCtxPool::FUEFDCtxPool(int32 InMaxPooled) : MaxPooled(InMaxPooled) {}
+
+FUEFDCtxPool::~FUEFDCtxPool() { //Destructor
+	Trim();
+}
+
+FUEFDCtxPool::FScopedContext FUEFDCtxPool::AcquireShared()
+{
+	return FScopedContext(FUEFormatModule::GetDCtxPool());
+}
+
+FUEFDCtxPool::FStats FUEFDCtxPool::GetStats() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Stats;
+}
+
+void FUEFDCtxPool::Trim()
+{
+	FScopeLock ScopeLock(&Lock);
+	for (ZSTD_DCtx_s* Context : FreeContexts)
+		ZSTD_freeDCtx(Context);
+	FreeContexts.Empty();
+	Stats.Pooled = 0;
+}
+
+ZSTD_DCtx_s* FUEFDCtxPool::Pop()
+{
+	{
+		FScopeLock ScopeLock(&Lock);
+		++Stats.InUse;
+		if (FreeContexts.Num() > 0)
+		{
+			++Stats.Hits;
+			Stats.Pooled = FreeContexts.Num() - 1;
+			return FreeContexts.Pop(EAllowShrinking::No);
+		}
+		++Stats.Misses;
+	}
+	// Created outside the lock, the allocation is what we are trying to avoid contending on
+	return ZSTD_createDCtx();
+}
+
+void FUEFDCtxPool::Push(ZSTD_DCtx_s* Context)
+{
+	if (!Context)
+		return;
+
+	// Drop any session state and dictionary so the next borrower starts clean
+	ZSTD_DCtx_reset(Context, ZSTD_reset_session_and_parameters);
+
+	{
+		FScopeLock ScopeLock(&Lock);
+		--Stats.InUse;
+		if (FreeContexts.Num() < MaxPooled)
+		{
+			FreeContexts.Push(Context);
+			Stats.Pooled = FreeContexts.Num();
+			return;
+		}
+	}
+	ZSTD_freeDCtx(Context);
+}
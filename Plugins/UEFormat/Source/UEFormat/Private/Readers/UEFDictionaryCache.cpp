@@ -0,0 +1,94 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#include "Readers/UEFDictionaryCache.h"
+#include "UEFormat.h"
+#include "HAL/FileManager.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "zstd.h"
+#include "zdict.h"
+
+FUEFDictionaryCache::~FUEFDictionaryCache() { //Destructor
+	for (const TPair<uint32, ZSTD_DDict_s*>& Entry : Dictionaries)
+		ZSTD_freeDDict(Entry.Value);
+}
+
+uint32 FUEFDictionaryCache::Add(const TArray<uint8>& Dictionary)
+{
+	const uint32 DictID = ZDICT_getDictID(Dictionary.GetData(), Dictionary.Num());
+	if (DictID == 0)
+		return 0;
+
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (Dictionaries.Contains(DictID))
+			return DictID;
+	}
+
+	// Digesting builds the entropy tables, done outside the lock since it is the expensive part
+	ZSTD_DDict_s* DDict = ZSTD_createDDict(Dictionary.GetData(), Dictionary.Num());
+	if (!DDict)
+		return 0;
+
+	FScopeLock ScopeLock(&Lock);
+	if (Dictionaries.Contains(DictID))
+	{
+		// Lost a race against another thread adding the same dictionary
+		ZSTD_freeDDict(DDict);
+		return DictID;
+	}
+	Dictionaries.Add(DictID, DDict);
+	return DictID;
+}
+
+int32 FUEFDictionaryCache::LoadDirectory(const FString& Directory)
+{
+	TArray<FString> Files;
+	IFileManager::Get().FindFiles(Files, *FPaths::Combine(Directory, TEXT("*.zdict")), true, false);
+
+	int32 NumAdded = 0;
+	for (const FString& File : Files)
+	{
+		const FString Path = FPaths::Combine(Directory, File);
+		TArray<uint8> Dictionary;
+		if (!FFileHelper::LoadFileToArray(Dictionary, *Path))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Could not read ZSTD dictionary %s"), *Path);
+			continue;
+		}
+		if (Add(Dictionary) == 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("%s is not a ZSTD dictionary"), *Path);
+			continue;
+		}
+		++NumAdded;
+	}
+	return NumAdded;
+}
+
+ZSTD_DDict_s* FUEFDictionaryCache::Find(uint32 DictID) const
+{
+	FScopeLock ScopeLock(&Lock);
+	ZSTD_DDict_s* const* DDict = Dictionaries.Find(DictID);
+	return DDict ? *DDict : nullptr;
+}
+
+int32 FUEFDictionaryCache::Num() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Dictionaries.Num();
+}
+
+ZSTD_DDict_s* FUEFDictionaryCache::FindShared(uint32 DictID, TSharedPtr<FUEFDictionaryCache>& OutCache)
+{
+	OutCache = FUEFormatModule::GetDictionaries();
+	return OutCache.IsValid() ? OutCache->Find(DictID) : nullptr;
+}
+
+FString FUEFDictionaryCache::GetDefaultDirectory()
+{
+	const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("UEFormat"));
+	return Plugin.IsValid() ? FPaths::Combine(Plugin->GetBaseDir(), TEXT("Resources"), TEXT("Dictionaries")) : FString();
+}
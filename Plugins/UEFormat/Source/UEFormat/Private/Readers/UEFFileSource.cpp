@@ -0,0 +1,245 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#include "Readers/UEFFileSource.h"
+#include "Readers/UEFModelReader.h"
+#include "Readers/UEFDCtxPool.h"
+#include "Readers/UEFDictionaryCache.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Async/MappedFileHandle.h"
+#include "Misc/Compression.h"
+#include "zstd.h"
+
+static TAutoConsoleVariable<bool> CVarUEFormatMemoryMapped(
+	TEXT("UEFormat.Import.MemoryMapped"),
+	true,
+	TEXT("Memory-map .uemodel/.ueanim files on import and let bulk arrays reference the mapping instead of copying them."));
+
+static TAutoConsoleVariable<int32> CVarUEFormatStreamingThreshold(
+	TEXT("UEFormat.Import.StreamingThresholdMB"),
+	64,
+	TEXT("ZSTD payloads at least this large (uncompressed, in MB) are decompressed incrementally while parsing. 0 disables streaming."));
+
+static TAutoConsoleVariable<int32> CVarUEFormatParallelDecodeThreshold(
+	TEXT("UEFormat.Import.ParallelDecodeThresholdKB"),
+	256,
+	TEXT("Model chunks and animation tracks are decoded, and animation tracks resampled, on worker threads when the data being processed adds up to at least this many KB. 0 disables parallel decoding."));
+
+static bool ShouldStream(const FUEFormatHeader& Header)
+{
+	const int32 ThresholdMB = CVarUEFormatStreamingThreshold.GetValueOnAnyThread();
+	return ThresholdMB > 0 && Header.CompressionType == "ZSTD" && Header.UncompressedSize >= static_cast<int64>(ThresholdMB) * 1024 * 1024;
+}
+
+EUEFSourceMode GetDefaultSourceMode()
+{
+	return CVarUEFormatMemoryMapped.GetValueOnAnyThread() ? EUEFSourceMode::MemoryMapped : EUEFSourceMode::Stream;
+}
+
+bool ShouldDecodeInParallel(int64 Bytes)
+{
+	const int32 ThresholdKB = CVarUEFormatParallelDecodeThreshold.GetValueOnAnyThread();
+	return ThresholdKB > 0 && Bytes >= static_cast<int64>(ThresholdKB) * 1024;
+}
+
+FUEFFileSource::FUEFFileSource(const FString& Filename, EUEFSourceMode InMode) : Mode(InMode)
+{
+	if (Mode == EUEFSourceMode::MemoryMapped)
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		FOpenMappedResult Result = PlatformFile.OpenMappedEx(*Filename);
+		if (!Result.HasError())
+		{
+			MappedHandle = Result.StealValue();
+			MappedSize = MappedHandle->GetFileSize();
+			if (MappedSize > 0 && MappedSize <= MAX_int32)
+				MappedRegion.Reset(MappedHandle->MapRegion(0, MappedSize));
+		}
+
+		if (MappedRegion.IsValid())
+			MappedData = reinterpret_cast<const char*>(MappedRegion->GetMappedPtr());
+		else
+		{
+			// Not mappable (empty, too large or unsupported by the platform file), read it normally instead
+			MappedHandle.Reset();
+			Mode = EUEFSourceMode::Stream;
+		}
+	}
+
+	if (Mode == EUEFSourceMode::Stream)
+		Ar.open(ToCStr(Filename), std::ios::binary);
+}
+
+FUEFFileSource::~FUEFFileSource() { //Destructor
+	Close();
+	MappedRegion.Reset();
+	MappedHandle.Reset();
+}
+
+FUEFReadResult FUEFFileSource::ReadHeader(const std::string& Magic, FUEFormatHeader& Header)
+{
+	if (Mode == EUEFSourceMode::Stream)
+	{
+		if (!Ar.is_open())
+			return MakeError(FUEFReadError{ "", 0, TEXT("file could not be opened") });
+		if (ReadString(Ar, Magic.length()) != Magic)
+			return MakeError(FUEFReadError{ "", 0, TEXT("not a UEFormat file") });
+
+		Header.Identifier = ReadFString(Ar);
+		Header.FileVersionBytes = ReadData<std::byte>(Ar);
+		Header.ObjectName = ReadFString(Ar);
+		Header.IsCompressed = ReadData<uint8>(Ar) != 0;
+
+		if (Header.IsCompressed) {
+			Header.CompressionType = ReadFString(Ar);
+			Header.UncompressedSize = ReadData<int32>(Ar);
+			Header.CompressedSize = ReadData<int32>(Ar);
+		}
+		if (Ar.fail())
+			return MakeError(FUEFReadError{ "", 0, TEXT("truncated header") });
+	}
+	else
+	{
+		TOptional<FUEFReadError> Error;
+		FUEFBufferCursor Cursor(MappedData, static_cast<int32>(MappedSize), Error);
+		if (ReadBufferString(Cursor, Magic.length()) != Magic)
+			return MakeError(FUEFReadError{ "", 0, TEXT("not a UEFormat file") });
+
+		Header.Identifier = ReadBufferFString(Cursor);
+		Header.FileVersionBytes = ReadBufferData<std::byte>(Cursor);
+		Header.ObjectName = ReadBufferFString(Cursor);
+		Header.IsCompressed = ReadBufferData<uint8>(Cursor) != 0;
+
+		if (Header.IsCompressed) {
+			Header.CompressionType = ReadBufferFString(Cursor);
+			Header.UncompressedSize = ReadBufferData<int32>(Cursor);
+			Header.CompressedSize = ReadBufferData<int32>(Cursor);
+		}
+		if (Error.IsSet())
+			return MakeError(MoveTemp(Error.GetValue()));
+		MappedOffset = Cursor.GetOffset();
+	}
+
+	if (Header.IsCompressed && (Header.CompressedSize < 0 || Header.UncompressedSize < 0))
+		return MakeError(FUEFReadError{ "", 0, FString::Printf(TEXT("invalid compressed sizes %d/%d"), Header.CompressedSize, Header.UncompressedSize) });
+	return MakeValue();
+}
+
+FUEFReadResult FUEFFileSource::ReadPayload(const FUEFormatHeader& Header, bool bAllowStreaming)
+{
+	if (Mode == EUEFSourceMode::MemoryMapped)
+	{
+		const int32 RemainingSize = static_cast<int32>(MappedSize - MappedOffset);
+		if (!Header.IsCompressed)
+		{
+			Payload = MappedData + MappedOffset;
+			PayloadSize = RemainingSize;
+			return MakeValue();
+		}
+
+		if (Header.CompressedSize > RemainingSize)
+			return MakeError(FUEFReadError{ "", MappedOffset, TEXT("compressed data is truncated") });
+		if (bAllowStreaming && ShouldStream(Header))
+		{
+			Stream = MakeUnique<FUEFZstdStream>(MappedData + MappedOffset, Header.CompressedSize, Header.UncompressedSize);
+			return MakeValue();
+		}
+		return Decompress(Header, MappedData + MappedOffset);
+	}
+
+	if (Header.IsCompressed) {
+		const auto CurrentPos = Ar.tellg();
+		Ar.seekg(0, std::ios::end);
+		const auto RemainingSize = Ar.tellg() - CurrentPos;
+		Ar.seekg(CurrentPos, std::ios::beg);
+		if (Header.CompressedSize > RemainingSize)
+			return MakeError(FUEFReadError{ "", static_cast<int64>(CurrentPos), TEXT("compressed data is truncated") });
+		if (bAllowStreaming && ShouldStream(Header))
+		{
+			Stream = MakeUnique<FUEFZstdStream>(Ar, Header.CompressedSize, Header.UncompressedSize);
+			return MakeValue();
+		}
+
+		std::vector<char> CompressedBuffer(Header.CompressedSize);
+		Ar.read(CompressedBuffer.data(), Header.CompressedSize);
+		if (Ar.fail())
+			return MakeError(FUEFReadError{ "", static_cast<int64>(CurrentPos), TEXT("error reading compressed data") });
+		return Decompress(Header, CompressedBuffer.data());
+	}
+
+	const auto CurrentPos = Ar.tellg();
+	Ar.seekg(0, std::ios::end);
+	const auto RemainingSize = Ar.tellg() - CurrentPos;
+	Ar.seekg(CurrentPos, std::ios::beg);
+
+	PayloadStorage.resize(RemainingSize);
+	Ar.read(PayloadStorage.data(), RemainingSize);
+	if (Ar.fail())
+		return MakeError(FUEFReadError{ "", static_cast<int64>(CurrentPos), TEXT("error reading uncompressed data") });
+
+	Payload = PayloadStorage.data();
+	PayloadSize = static_cast<int32>(RemainingSize);
+	return MakeValue();
+}
+
+FUEFReadResult FUEFFileSource::Decompress(const FUEFormatHeader& Header, const char* CompressedData)
+{
+	// Never empty: the bundled zstd writes through a null destination when a frame has more content than declared
+	PayloadStorage.resize(FMath::Max(Header.UncompressedSize, 1));
+
+	if (Header.CompressionType == "ZSTD")
+	{
+		// Frames compressed against a trained dictionary name it in their header, 0 means none. The cache is held
+		// until the context that references the dictionary has been returned.
+		const uint32 DictID = ZSTD_getDictID_fromFrame(CompressedData, Header.CompressedSize);
+		TSharedPtr<FUEFDictionaryCache> Dictionaries;
+		const ZSTD_DDict* DDict = DictID != 0 ? FUEFDictionaryCache::FindShared(DictID, Dictionaries) : nullptr;
+		if (DictID != 0 && !DDict)
+			return MakeError(FUEFReadError{ "ZSTD", 0, FString::Printf(TEXT("needs dictionary %u, which is not loaded"), DictID) });
+
+		const FUEFDCtxPool::FScopedContext Context = FUEFDCtxPool::AcquireShared();
+		if (!Context.Get())
+			return MakeError(FUEFReadError{ "ZSTD", 0, TEXT("could not create a decompression context") });
+
+		const size_t Result = DDict
+			? ZSTD_decompress_usingDDict(Context.Get(), PayloadStorage.data(), Header.UncompressedSize, CompressedData, Header.CompressedSize, DDict)
+			: ZSTD_decompressDCtx(Context.Get(), PayloadStorage.data(), Header.UncompressedSize, CompressedData, Header.CompressedSize);
+		if (ZSTD_isError(Result))
+			return MakeError(FUEFReadError{ "ZSTD", 0, FString::Printf(TEXT("decompression failed: %hs"), ZSTD_getErrorName(Result)) });
+		if (Result != static_cast<size_t>(Header.UncompressedSize))
+			return MakeError(FUEFReadError{ "ZSTD", 0, FString::Printf(TEXT("decompressed %llu bytes, header declares %d"), static_cast<uint64>(Result), Header.UncompressedSize) });
+	}
+	else if (Header.CompressionType == "GZIP")
+	{
+		if (!FCompression::UncompressMemory(NAME_Gzip, PayloadStorage.data(), Header.UncompressedSize, CompressedData, Header.CompressedSize))
+			return MakeError(FUEFReadError{ "GZIP", 0, TEXT("decompression failed") });
+	}
+	else
+		return MakeError(FUEFReadError{ Header.CompressionType, 0, TEXT("unknown compression type") });
+
+	Payload = PayloadStorage.data();
+	PayloadSize = Header.UncompressedSize;
+	return MakeValue();
+}
+
+void FUEFFileSource::Close()
+{
+	Stream.Reset();
+	if (Ar.is_open()) {
+		Ar.close();
+	}
+
+	if (Mode == EUEFSourceMode::Stream)
+	{
+		std::vector<char>().swap(PayloadStorage);
+		Payload = nullptr;
+		PayloadSize = 0;
+	}
+	else if (!PayloadStorage.empty())
+	{
+		// Decompressed payload is self-contained, the mapping is no longer needed
+		MappedRegion.Reset();
+		MappedHandle.Reset();
+		MappedData = nullptr;
+	}
+}
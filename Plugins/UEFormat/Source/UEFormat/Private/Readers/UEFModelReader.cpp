@@ -1,10 +1,12 @@
 // Copyright © 2025 Marcel K. All rights reserved.
 
 #include "Readers/UEFModelReader.h"
+#include "UEFQuatKernels.h"
+#include "Async/ParallelFor.h"
 #include <string>
-#include "zstd.h"
-#include "Misc/Compression.h"
-#include <vector>
+
+// Header strings are names and type tags, anything longer is a corrupt length prefix
+static constexpr int32 MaxHeaderStringLength = 64 * 1024;
 
 std::string ReadString(std::ifstream& Ar, int32 Size)
 {
@@ -17,242 +19,495 @@ std::string ReadString(std::ifstream& Ar, int32 Size)
 std::string ReadFString(std::ifstream& Ar)
 {
     int32 Size = ReadData<int32>(Ar);
+    if (Ar.fail() || Size < 0 || Size > MaxHeaderStringLength) {
+        Ar.setstate(std::ios::failbit);
+        return std::string();
+    }
     std::string String;
     String.resize(Size);
     Ar.read(String.data(), Size);
     return String;
 }
 
-FQuat4f ReadBufferQuat(const char* DataArray, int& Offset)
+FQuat4f ReadBufferQuat(FUEFBufferCursor& Cursor)
 {
-    float X = ReadBufferData<float>(DataArray, Offset);
-    float Y = ReadBufferData<float>(DataArray, Offset);
-    float Z = ReadBufferData<float>(DataArray, Offset);
-    float W = ReadBufferData<float>(DataArray, Offset);
+    float X = ReadBufferData<float>(Cursor);
+    float Y = ReadBufferData<float>(Cursor);
+    float Z = ReadBufferData<float>(Cursor);
+    float W = ReadBufferData<float>(Cursor);
     return FQuat4f(X, Y, Z, W).GetNormalized(); // Directly return the value
 }
 
-std::string ReadBufferString(const char* DataArray, int& Offset, int32 Size)
+std::string ReadBufferString(FUEFBufferCursor& Cursor, int32 Size)
 {
-    std::string String;
-    String.resize(Size);
-    std::memcpy(String.data(), &DataArray[Offset], Size);
-    Offset += Size;
-    return String;
+    const char* Src = Cursor.Consume(Size);
+    if (!Src)
+        return std::string();
+    return std::string(Src, Size);
 }
 
-std::string ReadBufferFString(const char* DataArray, int& Offset)
+std::string ReadBufferFString(FUEFBufferCursor& Cursor)
 {
-    int32 Size = ReadBufferData<int32>(DataArray, Offset);
-    std::string String;
-    String.resize(Size);
-    std::memcpy(String.data(), &DataArray[Offset], Size);
-    Offset += Size;
-    return String;
+    int32 Size = ReadBufferData<int32>(Cursor);
+    return ReadBufferString(Cursor, Size);
+}
+
+FAnsiStringView ReadBufferStringView(FUEFBufferCursor& Cursor, FUEFArena& Arena)
+{
+    int32 Size = ReadBufferData<int32>(Cursor);
+    const char* Src = Cursor.Consume(Size);
+    if (!Src)
+        return FAnsiStringView();
+    return Arena.CopyString(Src, Size);
+}
+
+FUEFNameIndex ReadBufferName(FUEFBufferCursor& Cursor, FUEFNameTable& Names)
+{
+    int32 Size = ReadBufferData<int32>(Cursor);
+    // FName asserts on anything longer
+    if (Size >= NAME_SIZE)
+    {
+        Cursor.SetError(FString::Printf(TEXT("name of %d characters, FName allows %d"), Size, NAME_SIZE - 1));
+        return INDEX_NONE;
+    }
+    const char* Src = Cursor.Consume(Size);
+    if (!Src)
+        return INDEX_NONE;
+    return Names.Add(Src, Size);
 }
 
-UEFModelReader::UEFModelReader(const FString Filename) : Ar(ToCStr(Filename), std::ios::binary) {}
+UEFModelReader::UEFModelReader(const FString Filename, EUEFSourceMode Mode) : Source(Filename, Mode) {}
 
 UEFModelReader::~UEFModelReader() { //Destructor
-    if (Ar.is_open()) {
-        Ar.close();
+    Source.Close();
+}
+
+FUEFReadResult UEFModelReader::OpenSource(bool bAllowStreaming) {
+    if (FUEFReadResult Result = Source.ReadHeader(GMAGIC, Header); Result.HasError()) return Result;
+    if (FUEFReadResult Result = Source.ReadPayload(Header, bAllowStreaming); Result.HasError()) return Result;
+
+    // Bulk arrays may only point into the payload if it outlives the reader's use of it
+    bReferencePayload = Source.IsPayloadPersistent();
+    VertexIndexLimit = (Header.IsCompressed ? Header.UncompressedSize : Source.GetPayloadSize()) / static_cast<int32>(sizeof(FVector3f));
+    return MakeValue();
+}
+
+FUEFReadResult UEFModelReader::Read() {
+    if (FUEFReadResult Result = OpenSource(true); Result.HasError()) return Result;
+
+    if (FUEFZstdStream* Stream = Source.GetStream())
+    {
+        ReadStream(*Stream);
+        TOptional<FUEFReadError> StreamError = MoveTemp(Stream->GetError());
+        Source.Close();
+        if (StreamError.IsSet())
+            return MakeError(MoveTemp(StreamError.GetValue()));
+        return ValidateLODs();
     }
+
+    if (FUEFReadResult Result = BuildIndex(); Result.HasError()) return Result;
+    FUEFReadResult Result = ReadEntries([](const FUEFChunkEntry&) { return true; });
+    Source.Close();
+    if (Result.HasError()) return Result;
+    return ValidateLODs();
+}
+
+FUEFReadResult UEFModelReader::Open() {
+    // Chunks are decoded in any order later, so the payload has to be fully decompressed
+    if (FUEFReadResult Result = OpenSource(false); Result.HasError()) return Result;
+    return BuildIndex();
+}
+
+FUEFReadResult UEFModelReader::ReadLOD(int32 LODIndex) {
+    if (!LODs.IsValidIndex(LODIndex))
+        return MakeError(FUEFReadError{ "LODS", 0, FString::Printf(TEXT("LOD %d does not exist"), LODIndex) });
+    if (FUEFReadResult Result = ReadEntries([LODIndex](const FUEFChunkEntry& Entry) { return Entry.LODIndex == LODIndex; }); Result.HasError()) return Result;
+    return ValidateLOD(LODIndex);
+}
+
+FUEFReadResult UEFModelReader::ReadSkeletonOnly() {
+    return ReadEntries([](const FUEFChunkEntry& Entry) { return Entry.LODIndex == INDEX_NONE; });
+}
+
+FUEFReadResult UEFModelReader::ReadChunk(const std::string& ChunkName, int32 LODIndex) {
+    return ReadEntries([&ChunkName, LODIndex](const FUEFChunkEntry& Entry) {
+        return Entry.Name == ChunkName && (Entry.LODIndex == INDEX_NONE || Entry.LODIndex == LODIndex);
+    });
 }
 
-bool UEFModelReader::Read() {
-    std::string Magic = ReadString(Ar, GMAGIC.length());
-    if (Magic != GMAGIC) return false;
-
-    Header.Identifier = ReadFString(Ar);
-    Header.FileVersionBytes = ReadData<std::byte>(Ar);
-    Header.ObjectName = ReadFString(Ar);
-    Header.IsCompressed = ReadData<bool>(Ar);
-
-    if (Header.IsCompressed) {
-        Header.CompressionType = ReadFString(Ar);
-        Header.UncompressedSize = ReadData<int32>(Ar);
-        Header.CompressedSize = ReadData<int32>(Ar);
-
-        std::vector<char> CompressedBuffer(Header.CompressedSize);
-        Ar.read(CompressedBuffer.data(), Header.CompressedSize);
-        if (Ar.fail()) {
-            UE_LOG(LogTemp, Error, TEXT("Error reading compressed data."));
-            return false;
+FUEFReadResult UEFModelReader::BuildIndex() {
+    TableOfContents.Reset();
+    TOptional<FUEFReadError> Error;
+    FUEFBufferCursor Cursor(Source.GetPayload(), Source.GetPayloadSize(), Error);
+    while (!Cursor.IsAtEnd() && !Cursor.IsError())
+    {
+        std::string ChunkName = ReadBufferFString(Cursor);
+        int32 ArraySize = ReadBufferData<int32>(Cursor);
+        int32 ByteSize = ReadBufferData<int32>(Cursor);
+        FUEFBufferCursor ChunkCursor = Cursor.Slice(ByteSize, ChunkName);
+
+        if (ChunkName == "LODS")
+        {
+            if (!ChunkCursor.RequireCount(ArraySize, 8))
+                break;
+            LODs.SetNum(ArraySize);
+            for (int32 index = 0; index < ArraySize && !ChunkCursor.IsError(); ++index) {
+                std::string LODName = ReadBufferFString(ChunkCursor);
+                int32 LODByteSize = ReadBufferData<int32>(ChunkCursor);
+                FUEFBufferCursor LODCursor = ChunkCursor.Slice(LODByteSize, LODName);
+                IndexChunks(LODCursor, index);
+            }
         }
+        else if (ChunkName == "SKELETON")
+            IndexChunks(ChunkCursor, INDEX_NONE);
+    }
 
-        std::vector<char> UncompressedBuffer(Header.UncompressedSize);
+    if (Error.IsSet())
+        return MakeError(MoveTemp(Error.GetValue()));
 
-        if (Header.CompressionType == "ZSTD")
-            ZSTD_decompress(UncompressedBuffer.data(), Header.UncompressedSize, CompressedBuffer.data(), Header.CompressedSize);
+    // A repeated chunk overwrites the earlier one, which only gives a defined result when decoded in file order
+    bHasDuplicateChunks = false;
+    for (int32 Index = 0; Index < TableOfContents.Num() && !bHasDuplicateChunks; ++Index)
+    {
+        for (int32 Other = Index + 1; Other < TableOfContents.Num(); ++Other)
+        {
+            if (TableOfContents[Index].LODIndex == TableOfContents[Other].LODIndex && TableOfContents[Index].Name == TableOfContents[Other].Name)
+            {
+                bHasDuplicateChunks = true;
+                break;
+            }
+        }
+    }
 
-        else if (Header.CompressionType == "GZIP")
-            FCompression::UncompressMemory(NAME_Gzip, UncompressedBuffer.data(), Header.UncompressedSize, CompressedBuffer.data(), Header.CompressedSize);
+    bIndexed = true;
+    return MakeValue();
+}
 
-        ReadBuffer(UncompressedBuffer.data(), Header.UncompressedSize);
+void UEFModelReader::IndexChunks(FUEFBufferCursor& Cursor, int32 LODIndex) {
+    while (!Cursor.IsAtEnd() && !Cursor.IsError())
+    {
+        FUEFChunkEntry Entry;
+        Entry.Name = ReadBufferFString(Cursor);
+        Entry.LODIndex = LODIndex;
+        Entry.ArraySize = ReadBufferData<int32>(Cursor);
+        const int32 ByteSize = ReadBufferData<int32>(Cursor);
+        Entry.Offset = Cursor.GetOffset();
+        FUEFBufferCursor Chunk = Cursor.Slice(ByteSize, Entry.Name);
+        if (Chunk.IsError())
+            return;
+        Entry.Path = Chunk.GetChunkName();
+        Entry.ByteSize = ByteSize;
+        TableOfContents.Add(MoveTemp(Entry));
     }
-    else {
-        const auto CurrentPos = Ar.tellg();
-        Ar.seekg(0, std::ios::end);
-        const auto RemainingSize = Ar.tellg() - CurrentPos;
-        Ar.seekg(CurrentPos, std::ios::beg);
-        
-        std::vector<char> UncompressedBuffer(RemainingSize);
-        Ar.read(UncompressedBuffer.data(), RemainingSize);
-        if (Ar.fail()) {
-            UE_LOG(LogTemp, Error, TEXT("Error reading uncompressed data."));
-            return false;
+}
+
+FUEFReadResult UEFModelReader::ReadEntries(TFunctionRef<bool(const FUEFChunkEntry&)> Filter) {
+    if (!bIndexed)
+        return MakeError(FUEFReadError{ "", 0, TEXT("the file has not been opened") });
+
+    TArray<const FUEFChunkEntry*> Entries;
+    int64 TotalBytes = 0;
+    for (const FUEFChunkEntry& Entry : TableOfContents)
+    {
+        if (Filter(Entry))
+        {
+            Entries.Add(&Entry);
+            TotalBytes += Entry.ByteSize;
         }
+    }
+
+    // Every chunk writes its own LOD or skeleton field, so chunks can be decoded in any order as long as no
+    // field is written twice. Each one records its own error and the earliest in the file is reported.
+    TArray<TOptional<FUEFReadError>> Errors;
+    Errors.SetNum(Entries.Num());
+    auto DecodeEntry = [this, &Entries, &Errors](int32 Index) {
+        const FUEFChunkEntry& Entry = *Entries[Index];
+        FUEFBufferCursor Root(Source.GetPayload() + Entry.Offset, Entry.ByteSize, Errors[Index], Entry.Offset);
+        FUEFBufferCursor Chunk = Root.Slice(Entry.ByteSize, Entry.Path);
+        ReadChunk(Entry.Name, Entry.ArraySize, Chunk, Entry.LODIndex);
+    };
 
-        ReadBuffer(UncompressedBuffer.data(), RemainingSize);
+    if (!bHasDuplicateChunks && Entries.Num() > 1 && ShouldDecodeInParallel(TotalBytes))
+    {
+        // Largest chunks first, so a big WEIGHTS or MORPHTARGETS chunk doesn't start last and run alone
+        TArray<int32> Order;
+        Order.SetNumUninitialized(Entries.Num());
+        for (int32 Index = 0; Index < Order.Num(); ++Index)
+            Order[Index] = Index;
+        Order.StableSort([&Entries](int32 A, int32 B) { return Entries[A]->ByteSize > Entries[B]->ByteSize; });
+        ParallelFor(Order.Num(), [&Order, &DecodeEntry](int32 Index) { DecodeEntry(Order[Index]); });
+    }
+    else
+    {
+        // Stops at the first chunk that fails, later chunks of a corrupt file are not decoded
+        for (int32 Index = 0; Index < Entries.Num(); ++Index)
+        {
+            DecodeEntry(Index);
+            if (Errors[Index].IsSet())
+                break;
+        }
     }
 
-    Ar.close();
-    return true;
+    for (TOptional<FUEFReadError>& Error : Errors)
+    {
+        if (Error.IsSet())
+            return MakeError(MoveTemp(Error.GetValue()));
+    }
+    return MakeValue();
 }
 
-void UEFModelReader::ReadBuffer(const char* Buffer, int32 BufferSize) {
-    int32 Offset = 0;
+FUEFReadResult UEFModelReader::ValidateLODs() const {
+    for (int32 LODIndex = 0; LODIndex < LODs.Num(); ++LODIndex)
+    {
+        if (FUEFReadResult Result = ValidateLOD(LODIndex); Result.HasError()) return Result;
+    }
+    return MakeValue();
+}
+
+FUEFReadResult UEFModelReader::ValidateLOD(int32 LODIndex) const {
+    // Chunks are read independently, so whether they agree with each other is only known once the whole LOD is in.
+    // The checks cover every lookup the factories make, which index without checking.
+    const FLODData& LOD = LODs[LODIndex];
+    auto MakeLODError = [this, LODIndex](const char* ChunkName, FString Reason) -> FUEFReadResult {
+        for (const FUEFChunkEntry& Entry : TableOfContents)
+        {
+            if (Entry.LODIndex == LODIndex && Entry.Name == ChunkName)
+                return MakeError(FUEFReadError{ Entry.Path, Entry.Offset, MoveTemp(Reason) });
+        }
+        // Streamed reads keep no table of contents
+        return MakeError(FUEFReadError{ "LODS/LOD" + std::to_string(LODIndex) + "/" + ChunkName, 0, MoveTemp(Reason) });
+    };
+
+    const int32 NumVertices = LOD.Vertices.Num();
+    for (int32 Index = 0; Index < LOD.Indices.Num(); ++Index)
+    {
+        if (static_cast<uint32>(LOD.Indices[Index]) >= static_cast<uint32>(NumVertices))
+            return MakeLODError("INDICES", FString::Printf(TEXT("index %d refers to vertex %d of %d"), Index, LOD.Indices[Index], NumVertices));
+    }
+
+    for (int32 Index = 0; Index < LOD.Materials.Num(); ++Index)
+    {
+        const FMaterialChunk& Material = LOD.Materials[Index];
+        if (Material.FirstIndex < 0 || Material.NumFaces < 0 || Material.FirstIndex + static_cast<int64>(Material.NumFaces) * 3 > LOD.Indices.Num())
+            return MakeLODError("MATERIALS", FString::Printf(TEXT("material %d uses %d faces from index %d of %d"), Index, Material.NumFaces, Material.FirstIndex, LOD.Indices.Num()));
+    }
+
+    // Per-vertex attributes are optional, but when present they are looked up for every vertex
+    if (!LOD.Normals.IsEmpty() && LOD.Normals.Num() < NumVertices)
+        return MakeLODError("NORMALS", FString::Printf(TEXT("%d normals for %d vertices"), LOD.Normals.Num(), NumVertices));
+    if (!LOD.Tangents.IsEmpty() && LOD.Tangents.Num() < NumVertices)
+        return MakeLODError("TANGENTS", FString::Printf(TEXT("%d tangents for %d vertices"), LOD.Tangents.Num(), NumVertices));
+    if (!LOD.VertexColors.IsEmpty() && LOD.VertexColors[0].Data.Num() < NumVertices)
+        return MakeLODError("VERTEXCOLORS", FString::Printf(TEXT("%d vertex colors for %d vertices"), LOD.VertexColors[0].Data.Num(), NumVertices));
+    for (int32 Channel = 0; Channel < LOD.TextureCoordinates.Num(); ++Channel)
+    {
+        if (LOD.TextureCoordinates[Channel].Num() < NumVertices)
+            return MakeLODError("TEXCOORDS", FString::Printf(TEXT("%d texture coordinates in channel %d for %d vertices"), LOD.TextureCoordinates[Channel].Num(), Channel, NumVertices));
+    }
+    return MakeValue();
+}
 
-    while (Offset < BufferSize)
+void UEFModelReader::ReadStream(FUEFZstdStream& Stream) {
+    while (!Stream.IsAtEnd())
     {
-        std::string ChunkName = ReadBufferFString(Buffer, Offset);
-        int32 ArraySize = ReadBufferData<int32>(Buffer, Offset);
-        int32 ByteSize = ReadBufferData<int32>(Buffer, Offset);
+        std::string ChunkName = Stream.ReadFString();
+        int32 ArraySize = Stream.Read<int32>();
+        int32 ByteSize = Stream.Read<int32>();
+        const int64 ChunkEnd = Stream.GetOffset() + ByteSize;
 
         if (ChunkName == "LODS")
         {
+            if (ArraySize < 0 || ArraySize > ByteSize / 8) {
+                Stream.SetError(TEXT("invalid LOD count"));
+                return;
+            }
+
+            // LODs are decompressed and parsed one at a time, the window only has to hold the largest one
             LODs.SetNum(ArraySize);
-            for (int32 index = 0; index < ArraySize; ++index) {
-                std::string LODName = ReadBufferFString(Buffer, Offset);
-                int32 LODByteSize = ReadBufferData<int32>(Buffer, Offset);
-                ReadChunks(Buffer, Offset, LODByteSize, index);
+            for (int32 index = 0; index < ArraySize && !Stream.IsAtEnd(); ++index) {
+                std::string LODName = Stream.ReadFString();
+                int32 LODByteSize = Stream.Read<int32>();
+                if (Stream.GetOffset() + LODByteSize > ChunkEnd) {
+                    Stream.SetError(TEXT("LOD exceeds the LODS chunk"));
+                    return;
+                }
+                FUEFBufferCursor LODCursor = Stream.ReadSlice(LODByteSize, ChunkName + "/" + LODName);
+                ReadChunks(LODCursor, index);
             }
+            Stream.Skip(static_cast<int32>(ChunkEnd - Stream.GetOffset()));
         }
         else if (ChunkName == "SKELETON")
-            ReadChunks(Buffer, Offset, ByteSize, 0);
+        {
+            FUEFBufferCursor ChunkCursor = Stream.ReadSlice(ByteSize, ChunkName);
+            ReadChunks(ChunkCursor, INDEX_NONE);
+        }
         else
-            Offset += ByteSize;
+            Stream.Skip(ByteSize);
     }
 }
 
-void UEFModelReader::ReadChunks(const char* Buffer, int32& Offset, int32 ByteSize, int32 LODIndex) {
-    int32 InnerOffset = Offset; // Offset for nested data
-    while (InnerOffset < Offset + ByteSize)
+void UEFModelReader::ReadChunks(FUEFBufferCursor& Cursor, int32 LODIndex) {
+    while (!Cursor.IsAtEnd() && !Cursor.IsError())
     {
-        std::string InnerChunkName = ReadBufferFString(Buffer, InnerOffset);
-        int32 InnerArraySize = ReadBufferData<int32>(Buffer, InnerOffset);
-        int32 InnerByteSize = ReadBufferData<int32>(Buffer, InnerOffset);
-
-        if (InnerChunkName == "VERTICES")
-            ReadBufferArray(Buffer, InnerOffset, InnerArraySize, LODs[LODIndex].Vertices);
-        else if (InnerChunkName == "INDICES")
-            ReadBufferArray(Buffer, InnerOffset, InnerArraySize, LODs[LODIndex].Indices);
-        else if (InnerChunkName == "NORMALS")
-            ReadBufferArray(Buffer, InnerOffset, InnerArraySize, LODs[LODIndex].Normals);
-        else if (InnerChunkName == "TANGENTS")
-            ReadBufferArray(Buffer, InnerOffset, InnerArraySize, LODs[LODIndex].Tangents);
-        else if (InnerChunkName == "VERTEXCOLORS")
+        std::string InnerChunkName = ReadBufferFString(Cursor);
+        int32 InnerArraySize = ReadBufferData<int32>(Cursor);
+        int32 InnerByteSize = ReadBufferData<int32>(Cursor);
+        FUEFBufferCursor Chunk = Cursor.Slice(InnerByteSize, InnerChunkName);
+        if (Chunk.IsError())
+            return;
+        ReadChunk(InnerChunkName, InnerArraySize, Chunk, LODIndex);
+    }
+}
+
+void UEFModelReader::ReadChunk(const std::string& InnerChunkName, int32 InnerArraySize, FUEFBufferCursor& Chunk, int32 LODIndex) {
+    FLODData* LOD = LODs.IsValidIndex(LODIndex) ? &LODs[LODIndex] : nullptr;
+    const bool bIsLODChunk = InnerChunkName == "VERTICES" || InnerChunkName == "INDICES" || InnerChunkName == "NORMALS" || InnerChunkName == "TANGENTS"
+        || InnerChunkName == "VERTEXCOLORS" || InnerChunkName == "MATERIALS" || InnerChunkName == "TEXCOORDS" || InnerChunkName == "WEIGHTS" || InnerChunkName == "MORPHTARGETS";
+    if (bIsLODChunk && !LOD)
+    {
+        Chunk.SetError(TEXT("LOD data outside of a LOD"));
+        return;
+    }
+
+    if (InnerChunkName == "VERTICES")
+        ReadBufferBulk(Chunk, InnerArraySize, LOD->Vertices, Arena, bReferencePayload);
+    else if (InnerChunkName == "INDICES")
+        ReadBufferBulk(Chunk, InnerArraySize, LOD->Indices, Arena, bReferencePayload);
+    else if (InnerChunkName == "NORMALS")
+        ReadBufferBulk(Chunk, InnerArraySize, LOD->Normals, Arena, bReferencePayload);
+    else if (InnerChunkName == "TANGENTS")
+        ReadBufferBulk(Chunk, InnerArraySize, LOD->Tangents, Arena, bReferencePayload);
+    else if (InnerChunkName == "VERTEXCOLORS")
+    {
+        if (!Chunk.RequireCount(InnerArraySize, 8))
+            return;
+        LOD->VertexColors.SetNum(InnerArraySize);
+        for (auto i = 0; i < InnerArraySize && !Chunk.IsError(); i++)
         {
-            LODs[LODIndex].VertexColors.SetNum(InnerArraySize);
-            for (auto i = 0; i < InnerArraySize; i++)
-            {
-                LODs[LODIndex].VertexColors[i].Name = ReadBufferFString(Buffer, InnerOffset);
-                LODs[LODIndex].VertexColors[i].Count = ReadBufferData<int32>(Buffer, InnerOffset);
-                LODs[LODIndex].VertexColors[i].Data.SetNum(LODs[LODIndex].VertexColors[i].Count);
-                ReadBufferArray(Buffer, InnerOffset, LODs[LODIndex].VertexColors[i].Count, LODs[LODIndex].VertexColors[i].Data);
-            }
+            LOD->VertexColors[i].Name = ReadBufferName(Chunk, Names);
+            LOD->VertexColors[i].Count = ReadBufferData<int32>(Chunk);
+            ReadBufferBulk(Chunk, LOD->VertexColors[i].Count, LOD->VertexColors[i].Data, Arena, bReferencePayload);
         }
-        else if (InnerChunkName == "MATERIALS")
+    }
+    else if (InnerChunkName == "MATERIALS")
+    {
+        if (!Chunk.RequireCount(InnerArraySize, 16))
+            return;
+        LOD->Materials.SetNum(InnerArraySize);
+        for (auto i = 0; i < InnerArraySize && !Chunk.IsError(); i++)
         {
-            LODs[LODIndex].Materials.SetNum(InnerArraySize);
-            for (auto i = 0; i < InnerArraySize; i++)
-            {
-                LODs[LODIndex].Materials[i].Name = ReadBufferFString(Buffer, InnerOffset);
-                LODs[LODIndex].Materials[i].Path = ReadBufferFString(Buffer, InnerOffset);
-                LODs[LODIndex].Materials[i].FirstIndex = ReadBufferData<int32>(Buffer, InnerOffset);
-                LODs[LODIndex].Materials[i].NumFaces = ReadBufferData<int32>(Buffer, InnerOffset);
-            }
+            LOD->Materials[i].Name = ReadBufferName(Chunk, Names);
+            LOD->Materials[i].Path = ReadBufferStringView(Chunk, Arena);
+            LOD->Materials[i].FirstIndex = ReadBufferData<int32>(Chunk);
+            LOD->Materials[i].NumFaces = ReadBufferData<int32>(Chunk);
         }
-        else if (InnerChunkName == "TEXCOORDS")
+    }
+    else if (InnerChunkName == "TEXCOORDS")
+    {
+        if (!Chunk.RequireCount(InnerArraySize, 4))
+            return;
+        LOD->TextureCoordinates.SetNum(InnerArraySize);
+        for (auto i = 0; i < InnerArraySize && !Chunk.IsError(); i++)
         {
-            LODs[LODIndex].TextureCoordinates.SetNum(InnerArraySize);
-            for (auto i = 0; i < InnerArraySize; i++)
-                {
-                int32 UVCount = ReadBufferData<int32>(Buffer, InnerOffset);
-                LODs[LODIndex].TextureCoordinates[i].SetNum(UVCount);
-                for (auto j = 0; j < UVCount; j++)
-                {
-                    float U = ReadBufferData<float>(Buffer, InnerOffset);
-                    float V = ReadBufferData<float>(Buffer, InnerOffset);
-                    LODs[LODIndex].TextureCoordinates[i][j] = FVector2f(U,V);
-                }
-            }
+            int32 UVCount = ReadBufferData<int32>(Chunk);
+            ReadBufferBulk(Chunk, UVCount, LOD->TextureCoordinates[i], Arena, bReferencePayload);
         }
-        else if (InnerChunkName == "SOCKETS")
+    }
+    else if (InnerChunkName == "SOCKETS")
+    {
+        if (!Chunk.RequireCount(InnerArraySize, 48))
+            return;
+        Skeleton.Sockets.SetNum(InnerArraySize);
+        for (auto i = 0; i < InnerArraySize && !Chunk.IsError(); i++)
         {
-            Skeleton.Sockets.SetNum(InnerArraySize);
-            for (auto i = 0; i < InnerArraySize; i++)
-            {
-                Skeleton.Sockets[i].SocketName = ReadBufferFString(Buffer, InnerOffset);
-                Skeleton.Sockets[i].SocketParentName = ReadBufferFString(Buffer, InnerOffset);
-                Skeleton.Sockets[i].SocketPos = ReadBufferData<FVector3f>(Buffer, InnerOffset);
-                Skeleton.Sockets[i].SocketRot = ReadBufferQuat(Buffer, InnerOffset);
-                Skeleton.Sockets[i].SocketScale = ReadBufferData<FVector3f>(Buffer, InnerOffset);
-            }
+            Skeleton.Sockets[i].SocketName = ReadBufferName(Chunk, Names);
+            Skeleton.Sockets[i].SocketParentName = ReadBufferName(Chunk, Names);
+            Skeleton.Sockets[i].SocketPos = ReadBufferData<FVector3f>(Chunk);
+            Skeleton.Sockets[i].SocketRot = ReadBufferData<FQuat4f>(Chunk);
+            Skeleton.Sockets[i].SocketScale = ReadBufferData<FVector3f>(Chunk);
         }
-        else if (InnerChunkName == "BONES")
+        if (InnerArraySize > 0)
+            UEFNormalizeQuats(&Skeleton.Sockets[0].SocketRot, sizeof(FSocketChunk), InnerArraySize);
+    }
+    else if (InnerChunkName == "BONES")
+    {
+        if (!Chunk.RequireCount(InnerArraySize, 36))
+            return;
+        Skeleton.Bones.SetNum(InnerArraySize);
+        for (auto i = 0; i < InnerArraySize && !Chunk.IsError(); i++)
         {
-            Skeleton.Bones.SetNum(InnerArraySize);
-            for (auto i = 0; i < InnerArraySize; i++)
-            {
-                Skeleton.Bones[i].BoneName = ReadBufferFString(Buffer, InnerOffset);
-                Skeleton.Bones[i].BoneParentIndex = ReadBufferData<int32>(Buffer, InnerOffset);
-                Skeleton.Bones[i].BonePos = ReadBufferData<FVector3f>(Buffer, InnerOffset);
-                Skeleton.Bones[i].BoneRot = ReadBufferQuat(Buffer, InnerOffset);
-            }
+            Skeleton.Bones[i].BoneName = ReadBufferName(Chunk, Names);
+            Skeleton.Bones[i].BoneParentIndex = ReadBufferData<int32>(Chunk);
+            Skeleton.Bones[i].BonePos = ReadBufferData<FVector3f>(Chunk);
+            Skeleton.Bones[i].BoneRot = ReadBufferData<FQuat4f>(Chunk);
         }
-        else if (InnerChunkName == "WEIGHTS")
+        if (InnerArraySize > 0)
+            UEFNormalizeQuats(&Skeleton.Bones[0].BoneRot, sizeof(FBoneChunk), InnerArraySize);
+    }
+    else if (InnerChunkName == "WEIGHTS")
+    {
+        if (!Chunk.RequireCount(InnerArraySize, 10))
+            return;
+        // Packed as 10 bytes per weight: bone index, vertex index, amount. Grouped by vertex with a counting sort,
+        // the first pass counts the weights of every vertex and the second scatters them behind the summed counts.
+        const char* Src = Chunk.Consume(InnerArraySize * 10);
+        TArray<int32>& Offsets = LOD->Weights.Offsets;
+        Offsets.Reset();
+        for (auto i = 0; i < InnerArraySize; i++)
         {
-            LODs[LODIndex].Weights.SetNum(InnerArraySize);
-            for (auto i = 0; i < InnerArraySize; i++)
+            int32 VertexIndex;
+            std::memcpy(&VertexIndex, Src + i * 10 + 2, sizeof(int32));
+            if (VertexIndex < 0 || VertexIndex >= VertexIndexLimit)
             {
-                LODs[LODIndex].Weights[i].WeightBoneIndex = ReadBufferData<short>(Buffer, InnerOffset);
-                LODs[LODIndex].Weights[i].WeightVertexIndex = ReadBufferData<int32>(Buffer, InnerOffset);
-                LODs[LODIndex].Weights[i].WeightAmount = ReadBufferData<float>(Buffer, InnerOffset);
+                Chunk.SetError(FString::Printf(TEXT("weight %d refers to vertex %d"), i, VertexIndex));
+                Offsets.Reset();
+                return;
             }
+            if (VertexIndex + 2 > Offsets.Num())
+                Offsets.SetNumZeroed(VertexIndex + 2);
+            Offsets[VertexIndex + 1]++;
         }
-        else if (InnerChunkName == "MORPHTARGETS")
+        for (auto i = 1; i < Offsets.Num(); i++)
+            Offsets[i] += Offsets[i - 1];
+
+        TArray<int32> Cursors(Offsets.GetData(), FMath::Max(Offsets.Num() - 1, 0));
+        LOD->Weights.Weights.SetNumUninitialized(InnerArraySize);
+        for (auto i = 0; i < InnerArraySize; i++, Src += 10)
         {
-            LODs[LODIndex].Morphs.SetNum(InnerArraySize);
-            for (auto i = 0; i < InnerArraySize; i++)
-            {
-                LODs[LODIndex].Morphs[i].MorphName = ReadBufferFString(Buffer, InnerOffset);
-                const auto DeltaNum = ReadBufferData<int32>(Buffer, InnerOffset);
-                LODs[LODIndex].Morphs[i].MorphDeltas.SetNum(DeltaNum);
-                for (auto j = 0; j < DeltaNum; j++)
-                {
-                    LODs[LODIndex].Morphs[i].MorphDeltas[j].MorphPosition = ReadBufferData<FVector3f>(Buffer, InnerOffset);
-                    LODs[LODIndex].Morphs[i].MorphDeltas[j].MorphNormals = ReadBufferData<FVector3f>(Buffer, InnerOffset);
-                    LODs[LODIndex].Morphs[i].MorphDeltas[j].MorphVertexIndex = ReadBufferData<int32>(Buffer, InnerOffset);
-                }
-            }
+            int32 VertexIndex;
+            std::memcpy(&VertexIndex, Src + 2, sizeof(int32));
+            FWeightChunk& Weight = LOD->Weights.Weights[Cursors[VertexIndex]++];
+            std::memcpy(&Weight.WeightBoneIndex, Src, sizeof(short));
+            std::memcpy(&Weight.WeightAmount, Src + 6, sizeof(float));
         }
-        else if (InnerChunkName == "VIRTUALBONES")
+    }
+    else if (InnerChunkName == "MORPHTARGETS")
+    {
+        if (!Chunk.RequireCount(InnerArraySize, 8))
+            return;
+        LOD->Morphs.SetNum(InnerArraySize);
+        for (auto i = 0; i < InnerArraySize && !Chunk.IsError(); i++)
         {
-            Skeleton.VirtualBones.SetNum(InnerArraySize);
-            for (auto i = 0; i < InnerArraySize; i++)
-            {
-                Skeleton.VirtualBones[i].SourceBoneName = ReadBufferFString(Buffer, InnerOffset);
-                Skeleton.VirtualBones[i].TargetBoneName = ReadBufferFString(Buffer, InnerOffset);
-                Skeleton.VirtualBones[i].VirtualBoneName = ReadBufferFString(Buffer, InnerOffset);
-            }
+            LOD->Morphs[i].MorphName = ReadBufferName(Chunk, Names);
+            const auto DeltaNum = ReadBufferData<int32>(Chunk);
+            // Packed as position, normal, vertex index which matches FMorphTargetDataChunk exactly
+            ReadBufferBulk(Chunk, DeltaNum, LOD->Morphs[i].MorphDeltas, Arena, bReferencePayload);
         }
-        else if (InnerChunkName == "METADATA")
+    }
+    else if (InnerChunkName == "VIRTUALBONES")
+    {
+        if (!Chunk.RequireCount(InnerArraySize, 12))
+            return;
+        Skeleton.VirtualBones.SetNum(InnerArraySize);
+        for (auto i = 0; i < InnerArraySize && !Chunk.IsError(); i++)
         {
-            Skeleton.Path = ReadBufferFString(Buffer, InnerOffset);
+            Skeleton.VirtualBones[i].SourceBoneName = ReadBufferName(Chunk, Names);
+            Skeleton.VirtualBones[i].TargetBoneName = ReadBufferName(Chunk, Names);
+            Skeleton.VirtualBones[i].VirtualBoneName = ReadBufferName(Chunk, Names);
         }
-        else
-            InnerOffset += InnerByteSize;
     }
-    Offset += ByteSize;
+    else if (InnerChunkName == "METADATA")
+    {
+        Skeleton.Path = ReadBufferStringView(Chunk, Arena);
+    }
 }
\ No newline at end of file
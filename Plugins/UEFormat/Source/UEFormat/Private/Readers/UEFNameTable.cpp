@@ -0,0 +1,18 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#include "Readers/UEFNameTable.h"
+#include "Misc/ScopeLock.h"
+
+FUEFNameIndex FUEFNameTable::Add(const char* Data, int32 Len)
+{
+	FScopeLock ScopeLock(&Lock);
+	if (const FUEFNameIndex* Existing = Lookup.Find(FAnsiStringView(Data, Len)))
+		return *Existing;
+
+	// Names in the file are ANSI, so they go to FName without a wide conversion
+	const FAnsiStringView View = Strings.CopyString(Data, Len);
+	const FUEFNameIndex Index = Names.Add(FName(Len, Data));
+	Views.Add(View);
+	Lookup.Add(View, Index);
+	return Index;
+}
@@ -0,0 +1,130 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#include "UEFQuatKernels.h"
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS && PLATFORM_CPU_X86_FAMILY
+	#include <immintrin.h>
+	#define UEF_QUAT_SSE 1
+	#define UEF_QUAT_AVX2 PLATFORM_ALWAYS_HAS_AVX_2
+#else
+	#define UEF_QUAT_SSE 0
+	#define UEF_QUAT_AVX2 0
+#endif
+
+namespace
+{
+	FORCEINLINE void NormalizeScalar(const char* Src, char* Dst)
+	{
+		float Quat[4];
+		std::memcpy(Quat, Src, sizeof(Quat));
+		const FQuat4f Result = FQuat4f(Quat[0], Quat[1], Quat[2], Quat[3]).GetNormalized();
+		std::memcpy(Dst, &Result, sizeof(float) * 4);
+	}
+
+#if UEF_QUAT_SSE
+	// Four quaternions at a time: transpose to X/Y/Z/W registers, scale, transpose back
+	FORCEINLINE void NormalizeSSE(const char* Src, int32 SrcStride, char* Dst, int32 DstStride)
+	{
+		__m128 Q0 = _mm_loadu_ps(reinterpret_cast<const float*>(Src));
+		__m128 Q1 = _mm_loadu_ps(reinterpret_cast<const float*>(Src + SrcStride));
+		__m128 Q2 = _mm_loadu_ps(reinterpret_cast<const float*>(Src + SrcStride * 2));
+		__m128 Q3 = _mm_loadu_ps(reinterpret_cast<const float*>(Src + SrcStride * 3));
+		_MM_TRANSPOSE4_PS(Q0, Q1, Q2, Q3);
+
+		const __m128 SizeSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(Q0, Q0), _mm_mul_ps(Q1, Q1)), _mm_add_ps(_mm_mul_ps(Q2, Q2), _mm_mul_ps(Q3, Q3)));
+		const __m128 Valid = _mm_cmpge_ps(SizeSquared, _mm_set1_ps(UE_SMALL_NUMBER));
+		const __m128 One = _mm_set1_ps(1.0f);
+		const __m128 Scale = _mm_div_ps(One, _mm_sqrt_ps(SizeSquared));
+
+		// Degenerate quaternions become identity
+		Q0 = _mm_and_ps(Valid, _mm_mul_ps(Q0, Scale));
+		Q1 = _mm_and_ps(Valid, _mm_mul_ps(Q1, Scale));
+		Q2 = _mm_and_ps(Valid, _mm_mul_ps(Q2, Scale));
+		Q3 = _mm_or_ps(_mm_and_ps(Valid, _mm_mul_ps(Q3, Scale)), _mm_andnot_ps(Valid, One));
+
+		_MM_TRANSPOSE4_PS(Q0, Q1, Q2, Q3);
+		_mm_storeu_ps(reinterpret_cast<float*>(Dst), Q0);
+		_mm_storeu_ps(reinterpret_cast<float*>(Dst + DstStride), Q1);
+		_mm_storeu_ps(reinterpret_cast<float*>(Dst + DstStride * 2), Q2);
+		_mm_storeu_ps(reinterpret_cast<float*>(Dst + DstStride * 3), Q3);
+	}
+#endif
+
+#if UEF_QUAT_AVX2
+	// Same 4x4 transpose as _MM_TRANSPOSE4_PS, applied to both 128-bit lanes
+	FORCEINLINE void Transpose8(__m256& R0, __m256& R1, __m256& R2, __m256& R3)
+	{
+		const __m256 T0 = _mm256_shuffle_ps(R0, R1, 0x44);
+		const __m256 T2 = _mm256_shuffle_ps(R0, R1, 0xEE);
+		const __m256 T1 = _mm256_shuffle_ps(R2, R3, 0x44);
+		const __m256 T3 = _mm256_shuffle_ps(R2, R3, 0xEE);
+		R0 = _mm256_shuffle_ps(T0, T1, 0x88);
+		R1 = _mm256_shuffle_ps(T0, T1, 0xDD);
+		R2 = _mm256_shuffle_ps(T2, T3, 0x88);
+		R3 = _mm256_shuffle_ps(T2, T3, 0xDD);
+	}
+
+	FORCEINLINE __m256 LoadPair(const char* Low, const char* High)
+	{
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(reinterpret_cast<const float*>(Low))), _mm_loadu_ps(reinterpret_cast<const float*>(High)), 1);
+	}
+
+	FORCEINLINE void StorePair(char* Low, char* High, __m256 Value)
+	{
+		_mm_storeu_ps(reinterpret_cast<float*>(Low), _mm256_castps256_ps128(Value));
+		_mm_storeu_ps(reinterpret_cast<float*>(High), _mm256_extractf128_ps(Value, 1));
+	}
+
+	// Eight quaternions at a time, lane 0 holds quaternions 0-3 and lane 1 holds 4-7
+	FORCEINLINE void NormalizeAVX2(const char* Src, int32 SrcStride, char* Dst, int32 DstStride)
+	{
+		__m256 Q0 = LoadPair(Src, Src + SrcStride * 4);
+		__m256 Q1 = LoadPair(Src + SrcStride, Src + SrcStride * 5);
+		__m256 Q2 = LoadPair(Src + SrcStride * 2, Src + SrcStride * 6);
+		__m256 Q3 = LoadPair(Src + SrcStride * 3, Src + SrcStride * 7);
+		Transpose8(Q0, Q1, Q2, Q3);
+
+		const __m256 SizeSquared = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(Q0, Q0), _mm256_mul_ps(Q1, Q1)), _mm256_add_ps(_mm256_mul_ps(Q2, Q2), _mm256_mul_ps(Q3, Q3)));
+		const __m256 Valid = _mm256_cmp_ps(SizeSquared, _mm256_set1_ps(UE_SMALL_NUMBER), _CMP_GE_OQ);
+		const __m256 One = _mm256_set1_ps(1.0f);
+		const __m256 Scale = _mm256_div_ps(One, _mm256_sqrt_ps(SizeSquared));
+
+		Q0 = _mm256_and_ps(Valid, _mm256_mul_ps(Q0, Scale));
+		Q1 = _mm256_and_ps(Valid, _mm256_mul_ps(Q1, Scale));
+		Q2 = _mm256_and_ps(Valid, _mm256_mul_ps(Q2, Scale));
+		Q3 = _mm256_blendv_ps(One, _mm256_mul_ps(Q3, Scale), Valid);
+
+		Transpose8(Q0, Q1, Q2, Q3);
+		StorePair(Dst, Dst + DstStride * 4, Q0);
+		StorePair(Dst + DstStride, Dst + DstStride * 5, Q1);
+		StorePair(Dst + DstStride * 2, Dst + DstStride * 6, Q2);
+		StorePair(Dst + DstStride * 3, Dst + DstStride * 7, Q3);
+	}
+#endif
+
+	void NormalizeStrided(const char* Src, int32 SrcStride, char* Dst, int32 DstStride, int32 Num)
+	{
+		int32 Index = 0;
+#if UEF_QUAT_AVX2
+		for (; Index + 8 <= Num; Index += 8)
+			NormalizeAVX2(Src + static_cast<int64>(Index) * SrcStride, SrcStride, Dst + static_cast<int64>(Index) * DstStride, DstStride);
+#endif
+#if UEF_QUAT_SSE
+		for (; Index + 4 <= Num; Index += 4)
+			NormalizeSSE(Src + static_cast<int64>(Index) * SrcStride, SrcStride, Dst + static_cast<int64>(Index) * DstStride, DstStride);
+#endif
+		for (; Index < Num; ++Index)
+			NormalizeScalar(Src + static_cast<int64>(Index) * SrcStride, Dst + static_cast<int64>(Index) * DstStride);
+	}
+}
+
+void UEFNormalizeQuats(FQuat4f* Quats, int32 Stride, int32 Num)
+{
+	char* Data = reinterpret_cast<char*>(Quats);
+	NormalizeStrided(Data, Stride, Data, Stride, Num);
+}
+
+void UEFDecodeNormalizedQuats(const char* Src, int32 SrcStride, FQuat4f* Dst, int32 DstStride, int32 Num)
+{
+	NormalizeStrided(Src, SrcStride, reinterpret_cast<char*>(Dst), DstStride, Num);
+}
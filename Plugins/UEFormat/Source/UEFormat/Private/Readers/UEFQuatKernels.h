@@ -0,0 +1,13 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+// Batched quaternion kernels used by the readers. Both match FQuat4f::GetNormalized(): quaternions whose squared
+// length is below UE_SMALL_NUMBER become identity. Strides are in bytes, so they can walk arrays of structs.
+
+// Normalizes Num quaternions in place.
+void UEFNormalizeQuats(FQuat4f* Quats, int32 Stride, int32 Num);
+
+// Reads Num quaternions stored as four packed floats from Src and writes them normalized to Dst.
+void UEFDecodeNormalizedQuats(const char* Src, int32 SrcStride, FQuat4f* Dst, int32 DstStride, int32 Num);
@@ -0,0 +1,164 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#include "Readers/UEFZstdStream.h"
+#include "Readers/UEFDictionaryCache.h"
+#include "zstd.h"
+
+// Smallest window, large enough that most chunks never cause it to grow
+static constexpr int32 MinWindowSize = 1024 * 1024;
+
+FUEFZstdStream::FUEFZstdStream(const char* InCompressed, int32 InCompressedSize, int32 InUncompressedSize)
+	: Context(FUEFDCtxPool::AcquireShared())
+{
+	InputData = InCompressed;
+	InputSize = InCompressedSize;
+	Init(InUncompressedSize);
+}
+
+FUEFZstdStream::FUEFZstdStream(std::ifstream& InAr, int32 InCompressedSize, int32 InUncompressedSize)
+	: Context(FUEFDCtxPool::AcquireShared())
+{
+	Ar = &InAr;
+	CompressedLeft = InCompressedSize;
+	InputBuffer.resize(ZSTD_DStreamInSize());
+	InputData = InputBuffer.data();
+	Init(InUncompressedSize);
+}
+
+void FUEFZstdStream::Init(int32 InUncompressedSize)
+{
+	UncompressedSize = InUncompressedSize;
+	Window.resize(FMath::Min(MinWindowSize, UncompressedSize));
+	// Pooled contexts come back reset, ZSTD_DCtx doubles as the streaming state
+	if (!Context.Get())
+		SetError(TEXT("could not create a decompression context"));
+}
+
+FUEFBufferCursor FUEFZstdStream::ReadSlice(int32 Bytes, const std::string& ChunkName)
+{
+	const bool bFilled = Fill(Bytes);
+	FUEFBufferCursor Cursor(Window.data() + ReadPos, bFilled ? Bytes : 0, Error, Consumed);
+	FUEFBufferCursor Slice = Cursor.Slice(bFilled ? Bytes : 0, ChunkName);
+	if (bFilled)
+		Advance(Bytes);
+	return Slice;
+}
+
+std::string FUEFZstdStream::ReadFString()
+{
+	const int32 Size = Read<int32>();
+	if (!Fill(Size))
+		return std::string();
+	std::string String(Window.data() + ReadPos, Size);
+	Advance(Size);
+	return String;
+}
+
+void FUEFZstdStream::Skip(int32 Bytes)
+{
+	if (Bytes < 0 || Bytes > UncompressedSize - Consumed)
+	{
+		SetError(FString::Printf(TEXT("cannot skip %d bytes"), Bytes));
+		return;
+	}
+
+	// Skipped data is decompressed piecewise and never needs a larger window
+	while (Bytes > 0 && !Error.IsSet())
+	{
+		const int32 Step = FMath::Min(Bytes, static_cast<int32>(Window.size()));
+		if (!Fill(Step))
+			return;
+		Advance(Step);
+		Bytes -= Step;
+	}
+}
+
+bool FUEFZstdStream::Fill(int32 Bytes)
+{
+	if (Error.IsSet())
+		return false;
+	if (Bytes < 0 || Bytes > UncompressedSize - Consumed)
+	{
+		SetError(FString::Printf(TEXT("needs %d bytes, %lld left"), Bytes, UncompressedSize - Consumed));
+		return false;
+	}
+	if (Filled - ReadPos >= Bytes)
+		return true;
+
+	// Drop consumed bytes, then grow only if this request is larger than anything seen so far
+	if (ReadPos > 0)
+	{
+		std::memmove(Window.data(), Window.data() + ReadPos, Filled - ReadPos);
+		Filled -= ReadPos;
+		ReadPos = 0;
+	}
+	if (static_cast<int32>(Window.size()) < Bytes)
+		Window.resize(Bytes);
+
+	while (Filled < Bytes)
+	{
+		if (InputPos >= InputSize && !RefillInput())
+		{
+			SetError(TEXT("compressed data is truncated"));
+			return false;
+		}
+
+		if (!bFrameStarted && !StartFrame())
+			return false;
+
+		ZSTD_inBuffer Input = { InputData, static_cast<size_t>(InputSize), static_cast<size_t>(InputPos) };
+		ZSTD_outBuffer Output = { Window.data(), Window.size(), static_cast<size_t>(Filled) };
+		const size_t Result = ZSTD_decompressStream(Context.Get(), &Output, &Input);
+		if (ZSTD_isError(Result))
+		{
+			SetError(FString::Printf(TEXT("decompression failed: %hs"), ZSTD_getErrorName(Result)));
+			return false;
+		}
+
+		InputPos = static_cast<int32>(Input.pos);
+		Filled = static_cast<int32>(Output.pos);
+		if (Result == 0 && Filled < Bytes)
+		{
+			SetError(TEXT("frame ended before the declared uncompressed size"));
+			return false;
+		}
+	}
+	return true;
+}
+
+bool FUEFZstdStream::StartFrame()
+{
+	// The frame header is at the start of the first input block, it names the dictionary if one was used
+	bFrameStarted = true;
+	const uint32 DictID = ZSTD_getDictID_fromFrame(InputData + InputPos, InputSize - InputPos);
+	if (DictID == 0)
+		return true;
+
+	const ZSTD_DDict* DDict = FUEFDictionaryCache::FindShared(DictID, Dictionaries);
+	if (!DDict)
+	{
+		SetError(FString::Printf(TEXT("needs dictionary %u, which is not loaded"), DictID));
+		return false;
+	}
+	// Referenced only, the pool resets parameters when the context is returned
+	ZSTD_DCtx_refDDict(Context.Get(), DDict);
+	return true;
+}
+
+bool FUEFZstdStream::RefillInput()
+{
+	if (!Ar || CompressedLeft <= 0)
+		return false;
+
+	InputSize = FMath::Min(CompressedLeft, static_cast<int32>(InputBuffer.size()));
+	InputPos = 0;
+	Ar->read(InputBuffer.data(), InputSize);
+	CompressedLeft -= InputSize;
+	return !Ar->fail();
+}
+
+void FUEFZstdStream::SetError(const FString& Reason)
+{
+	if (!Error.IsSet())
+		Error.Emplace(FUEFReadError{ "ZSTD", Consumed, Reason });
+}
@@ -1,15 +1,75 @@
 ﻿// Copyright Epic Games, Inc. All Rights Reserved.
 #include "../Public/UEFormat.h"
+#include "Misc/ScopeLock.h"
+
+// Readers on any thread look the module up while the game thread may be shutting it down
+static FCriticalSection LoadedModuleLock;
+static FUEFormatModule* LoadedModule = nullptr;
+
+static void LogDCtxPoolStats(const FUEFDCtxPool& Pool)
+{
+	const FUEFDCtxPool::FStats Stats = Pool.GetStats();
+	const int64 Total = Stats.Hits + Stats.Misses;
+	UE_LOG(LogTemp, Log, TEXT("UEFormat ZSTD context pool: %lld hits, %lld misses (%.1f%% hit rate), %d pooled, %d in use"),
+		Stats.Hits, Stats.Misses, Total > 0 ? 100.0 * Stats.Hits / Total : 0.0, Stats.Pooled, Stats.InUse);
+}
 
 void FUEFormatModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+	DCtxPool = MakeShared<FUEFDCtxPool>();
+	Dictionaries = MakeShared<FUEFDictionaryCache>();
+	const FString DictionaryDirectory = FUEFDictionaryCache::GetDefaultDirectory();
+	if (!DictionaryDirectory.IsEmpty())
+		Dictionaries->LoadDirectory(DictionaryDirectory);
+	DCtxPoolStatsCommand = MakeUnique<FAutoConsoleCommand>(
+		TEXT("UEFormat.DCtxPool.Stats"),
+		TEXT("Prints hit/miss statistics of the ZSTD decompression context pool."),
+		FConsoleCommandDelegate::CreateLambda([this]() { LogDCtxPoolStats(*DCtxPool); }));
+	FScopeLock ScopeLock(&LoadedModuleLock);
+	LoadedModule = this;
 }
 
 void FUEFormatModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	DCtxPoolStatsCommand.Reset();
+	// Unpublished under the lock, so no reader copies the pool or the dictionaries while they are released
+	TSharedPtr<FUEFDCtxPool> Pool;
+	TSharedPtr<FUEFDictionaryCache> DictionaryCache;
+	{
+		FScopeLock ScopeLock(&LoadedModuleLock);
+		LoadedModule = nullptr;
+		Pool = DCtxPool;
+		DCtxPool.Reset();
+		DictionaryCache = Dictionaries;
+		Dictionaries.Reset();
+	}
+	if (Pool.IsValid())
+	{
+		LogDCtxPoolStats(*Pool);
+		// Contexts still borrowed, e.g. by a commandlet worker, hold the pool until they are returned
+		Pool.Reset();
+	}
+	// Streams still decoding against a dictionary hold the cache until they finish
+	DictionaryCache.Reset();
+}
+
+TSharedPtr<FUEFDCtxPool> FUEFormatModule::GetDCtxPool()
+{
+	FScopeLock ScopeLock(&LoadedModuleLock);
+	if (!LoadedModule)
+		return nullptr;
+	return LoadedModule->DCtxPool;
+}
+
+TSharedPtr<FUEFDictionaryCache> FUEFormatModule::GetDictionaries()
+{
+	FScopeLock ScopeLock(&LoadedModuleLock);
+	if (!LoadedModule)
+		return nullptr;
+	return LoadedModule->Dictionaries;
 }
 
 IMPLEMENT_MODULE(FUEFormatModule, UEFormat)
\ No newline at end of file
@@ -5,4 +5,5 @@
 UEFAnimImportOptions::UEFAnimImportOptions()
 {
 	Skeleton = nullptr;
+	Interpolation = EUEFAnimInterpolation::Step;
 }
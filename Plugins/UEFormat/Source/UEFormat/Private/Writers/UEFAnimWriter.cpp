@@ -0,0 +1,74 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#include "Writers/UEFAnimWriter.h"
+#include "Factories/UEFKeyResampler.h"
+
+UEFAnimWriter::UEFAnimWriter(const FString InFilename, const FUEFWriteOptions& InOptions) : Filename(InFilename), Options(InOptions) {}
+
+namespace
+{
+	// Packs the two streams back into int32 frame + value keys, preceded by the key count
+	template<typename T>
+	void WriteKeys(FUEFPayloadWriter& Writer, const TUEFKeyStream<T>& Keys)
+	{
+		Writer.Write(Keys.Num());
+		for (int32 Index = 0; Index < Keys.Num(); Index++)
+		{
+			Writer.Write(Keys.Frames[Index]);
+			Writer.Write(Keys.Values[Index]);
+		}
+	}
+
+	// Reduces a copy of the keys, the reader's streams are left as they are
+	template<typename T>
+	void WriteReducedKeys(FUEFPayloadWriter& Writer, const TUEFKeyStream<T>& Keys, EUEFAnimInterpolation Interpolation, float Tolerance)
+	{
+		if (Tolerance < 0.0f)
+		{
+			WriteKeys(Writer, Keys);
+			return;
+		}
+		TArray<int32> Frames(Keys.Frames.GetData(), Keys.Num());
+		TArray<T> Values(Keys.Values.GetData(), Keys.Num());
+		TUEFKeyStream<T> Reduced{ Frames, Values };
+		UEFReduceKeys(Reduced, Interpolation, Tolerance);
+		WriteKeys(Writer, Reduced);
+	}
+}
+
+FUEFWriteResult UEFAnimWriter::Write(const UEFAnimReader& Anim)
+{
+	FUEFPayloadWriter Writer;
+
+	Writer.BeginChunk("METADATA", 1);
+	Writer.Write(Anim.NumFrames);
+	Writer.Write(Anim.FramesPerSecond);
+	Writer.WriteFString(Anim.RefPosePath);
+	Writer.Write(static_cast<uint8>(Anim.AdditiveAnimType));
+	Writer.Write(static_cast<uint8>(Anim.RefPoseType));
+	Writer.Write(Anim.RefFrameIndex);
+	Writer.End();
+
+	Writer.BeginChunk("TRACKS", Anim.Tracks.Num());
+	for (const FTrack& Track : Anim.Tracks)
+	{
+		Writer.WriteFString(Anim.Names.GetString(Track.TrackName));
+		WriteReducedKeys(Writer, Track.PosKeys, Options.KeyInterpolation, Options.PositionTolerance);
+		WriteReducedKeys(Writer, Track.RotKeys, Options.KeyInterpolation, Options.RotationTolerance);
+		WriteReducedKeys(Writer, Track.ScaleKeys, Options.KeyInterpolation, Options.ScaleTolerance);
+	}
+	Writer.End();
+
+	if (!Anim.Curves.IsEmpty())
+	{
+		Writer.BeginChunk("CURVES", Anim.Curves.Num());
+		for (const FCurve& Curve : Anim.Curves)
+		{
+			Writer.WriteFString(Anim.Names.GetString(Curve.CurveName));
+			WriteKeys(Writer, Curve.Keys);
+		}
+		Writer.End();
+	}
+
+	return UEFWriteFile(Filename, Anim.Header, Writer.GetData(), Options);
+}
@@ -0,0 +1,194 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#include "Writers/UEFDictionaryTrainer.h"
+#include "Readers/UEFDictionaryCache.h"
+#include "Readers/UEFModelReader.h"
+#include "Writers/UEFWriter.h"
+#include "UEFormat.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "zstd.h"
+#include "zdict.h"
+
+// Larger payloads compress well on their own and would dominate the training set
+static constexpr int32 MaxSampleSize = 1024 * 1024;
+
+FUEFDictionaryTrainer::FUEFDictionaryTrainer(int32 InCompressionLevel) : CompressionLevel(InCompressionLevel) {}
+
+FUEFDictionaryTrainer::~FUEFDictionaryTrainer() { //Destructor
+	ZSTD_freeCDict(CDict);
+}
+
+bool FUEFDictionaryTrainer::AddFile(const FString& Filename, FString& OutError)
+{
+	FUEFormatHeader Header;
+	TArray<uint8> Payload;
+	if (FUEFReadResult Result = UEFReadPayload(Filename, Header, Payload); Result.HasError())
+	{
+		OutError = Result.GetError().ToString();
+		return false;
+	}
+	if (Payload.Num() > MaxSampleSize)
+	{
+		OutError = FString::Printf(TEXT("payload of %d bytes is too large to benefit from a dictionary"), Payload.Num());
+		return false;
+	}
+
+	SampleData.Append(Payload);
+	SampleSizes.Add(Payload.Num());
+	return true;
+}
+
+int32 FUEFDictionaryTrainer::AddDirectory(const FString& Directory)
+{
+	TArray<FString> Files;
+	IFileManager::Get().FindFilesRecursive(Files, *Directory, TEXT("*.ueanim"), true, false);
+	IFileManager::Get().FindFilesRecursive(Files, *Directory, TEXT("*.uemodel"), true, false, false);
+
+	int32 NumAdded = 0;
+	for (const FString& File : Files)
+	{
+		FString Error;
+		if (AddFile(File, Error))
+			++NumAdded;
+		else
+			UE_LOG(LogTemp, Verbose, TEXT("Skipping %s: %s"), *File, *Error);
+	}
+	return NumAdded;
+}
+
+TValueOrError<uint32, FString> FUEFDictionaryTrainer::Train(int32 MaxDictionarySize)
+{
+	ZSTD_freeCDict(CDict);
+	CDict = nullptr;
+
+	// ZDICT_trainFromBuffer runs the fastCover optimizer over its default parameter grid
+	Dictionary.SetNumUninitialized(MaxDictionarySize);
+	const size_t Size = ZDICT_trainFromBuffer(Dictionary.GetData(), Dictionary.Num(), SampleData.GetData(), SampleSizes.GetData(), SampleSizes.Num());
+	if (ZDICT_isError(Size))
+	{
+		Dictionary.Empty();
+		return MakeError(FString::Printf(TEXT("training on %d samples failed: %hs"), SampleSizes.Num(), ZDICT_getErrorName(Size)));
+	}
+	Dictionary.SetNum(static_cast<int32>(Size));
+
+	CDict = ZSTD_createCDict(Dictionary.GetData(), Dictionary.Num(), CompressionLevel);
+	if (!CDict)
+		return MakeError(FString(TEXT("could not digest the trained dictionary")));
+	return MakeValue(ZDICT_getDictID(Dictionary.GetData(), Dictionary.Num()));
+}
+
+FUEFDictionaryTrainingStats FUEFDictionaryTrainer::Evaluate() const
+{
+	FUEFDictionaryTrainingStats Stats;
+	ZSTD_CCtx* Context = ZSTD_createCCtx();
+	TArray<uint8> Compressed;
+
+	const uint8* Sample = SampleData.GetData();
+	for (const size_t SampleSize : SampleSizes)
+	{
+		Compressed.SetNumUninitialized(static_cast<int32>(ZSTD_compressBound(SampleSize)), EAllowShrinking::No);
+		const size_t Plain = ZSTD_compressCCtx(Context, Compressed.GetData(), Compressed.Num(), Sample, SampleSize, CompressionLevel);
+		const size_t WithDict = CDict ? ZSTD_compress_usingCDict(Context, Compressed.GetData(), Compressed.Num(), Sample, SampleSize, CDict) : Plain;
+		if (!ZSTD_isError(Plain) && !ZSTD_isError(WithDict))
+		{
+			++Stats.NumSamples;
+			Stats.SampleBytes += SampleSize;
+			Stats.CompressedBytes += Plain;
+			Stats.DictCompressedBytes += WithDict;
+		}
+		Sample += SampleSize;
+	}
+
+	ZSTD_freeCCtx(Context);
+	return Stats;
+}
+
+bool FUEFDictionaryTrainer::CompressFile(const FString& InFile, const FString& OutFile, FString& OutError) const
+{
+	if (!CDict)
+	{
+		OutError = TEXT("no dictionary has been trained");
+		return false;
+	}
+
+	FUEFormatHeader Header;
+	TArray<uint8> Payload;
+	if (FUEFReadResult Result = UEFReadPayload(InFile, Header, Payload); Result.HasError())
+	{
+		OutError = Result.GetError().ToString();
+		return false;
+	}
+
+	FUEFWriteOptions Options;
+	Options.CompressionLevel = CompressionLevel;
+	Options.Dictionary = CDict;
+	if (FUEFWriteResult Result = UEFWriteFile(OutFile, Header, Payload, Options); Result.HasError())
+	{
+		OutError = Result.GetError();
+		return false;
+	}
+	return true;
+}
+
+static void TrainDictionary(const TArray<FString>& Args)
+{
+	if (Args.Num() < 1)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Usage: UEFormat.TrainDictionary <SourceDir> [MaxSizeKB=112] [OutputDir]"));
+		return;
+	}
+	const FString SourceDir = Args[0];
+	const int32 MaxSizeKB = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 112;
+	const FString OutputDir = Args.Num() > 2 ? Args[2] : FString();
+
+	FUEFDictionaryTrainer Trainer;
+	const int32 NumSamples = Trainer.AddDirectory(SourceDir);
+	TValueOrError<uint32, FString> DictID = Trainer.Train(FMath::Max(MaxSizeKB, 1) * 1024);
+	if (DictID.HasError())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Dictionary training over %s failed: %s"), *SourceDir, *DictID.GetError());
+		return;
+	}
+
+	const FString DictionaryDir = FUEFDictionaryCache::GetDefaultDirectory();
+	const FString DictionaryFile = FPaths::Combine(DictionaryDir, FString::Printf(TEXT("UEFormat_%u.zdict"), DictID.GetValue()));
+	if (DictionaryDir.IsEmpty() || !FFileHelper::SaveArrayToFile(Trainer.GetDictionary(), *DictionaryFile))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Could not write dictionary %s"), *DictionaryFile);
+		return;
+	}
+	if (const TSharedPtr<FUEFDictionaryCache> Dictionaries = FUEFormatModule::GetDictionaries())
+		Dictionaries->Add(Trainer.GetDictionary());
+
+	const FUEFDictionaryTrainingStats Stats = Trainer.Evaluate();
+	UE_LOG(LogTemp, Log, TEXT("Trained dictionary %u (%d bytes) on %d samples: %lld bytes compress to %lld without and %lld with the dictionary. Saved to %s"),
+		DictID.GetValue(), Trainer.GetDictionary().Num(), NumSamples, Stats.SampleBytes, Stats.CompressedBytes, Stats.DictCompressedBytes, *DictionaryFile);
+
+	if (OutputDir.IsEmpty())
+		return;
+
+	TArray<FString> Files;
+	IFileManager::Get().FindFilesRecursive(Files, *SourceDir, TEXT("*.ueanim"), true, false);
+	IFileManager::Get().FindFilesRecursive(Files, *SourceDir, TEXT("*.uemodel"), true, false, false);
+	int32 NumWritten = 0;
+	for (const FString& File : Files)
+	{
+		FString RelativePath = File;
+		FPaths::MakePathRelativeTo(RelativePath, *FPaths::Combine(SourceDir, TEXT("")));
+		FString Error;
+		if (Trainer.CompressFile(File, FPaths::Combine(OutputDir, RelativePath), Error))
+			++NumWritten;
+		else
+			UE_LOG(LogTemp, Warning, TEXT("Could not recompress %s: %s"), *File, *Error);
+	}
+	UE_LOG(LogTemp, Log, TEXT("Wrote %d dictionary-compressed files to %s"), NumWritten, *OutputDir);
+}
+
+static FAutoConsoleCommand TrainDictionaryCommand(
+	TEXT("UEFormat.TrainDictionary"),
+	TEXT("Trains a ZSTD dictionary over the UEFormat files below a directory and installs it in the plugin's Resources/Dictionaries. ")
+	TEXT("Usage: UEFormat.TrainDictionary <SourceDir> [MaxSizeKB=112] [OutputDir]. With OutputDir, dictionary-compressed copies of the files are written there."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&TrainDictionary));
@@ -0,0 +1,151 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#include "Writers/UEFModelWriter.h"
+
+UEFModelWriter::UEFModelWriter(const FString InFilename, const FUEFWriteOptions& InOptions) : Filename(InFilename), Options(InOptions) {}
+
+FUEFWriteResult UEFModelWriter::Write(const UEFModelReader& Model)
+{
+	return Write(Model.Header, Model.LODs, Model.Skeleton, Model.Names);
+}
+
+FUEFWriteResult UEFModelWriter::Write(const FUEFormatHeader& Header, TConstArrayView<FLODData> LODs, const FSkeletonData& Skeleton, const FUEFNameTable& Names)
+{
+	FUEFPayloadWriter Writer;
+
+	Writer.BeginChunk("LODS", LODs.Num());
+	for (int32 Index = 0; Index < LODs.Num(); ++Index)
+	{
+		const std::string LODName = "LOD" + std::to_string(Index);
+		Writer.BeginEntry(FAnsiStringView(LODName.data(), static_cast<int32>(LODName.size())));
+		WriteLOD(Writer, LODs[Index], Names);
+		Writer.End();
+	}
+	Writer.End();
+
+	Writer.BeginChunk("SKELETON", 1);
+	WriteSkeleton(Writer, Skeleton, Names);
+	Writer.End();
+
+	return UEFWriteFile(Filename, Header, Writer.GetData(), Options);
+}
+
+void UEFModelWriter::WriteLOD(FUEFPayloadWriter& Writer, const FLODData& LOD, const FUEFNameTable& Names)
+{
+	Writer.BeginChunk("VERTICES", LOD.Vertices.Num());
+	Writer.WriteArray(LOD.Vertices.AsView());
+	Writer.End();
+
+	Writer.BeginChunk("INDICES", LOD.Indices.Num());
+	Writer.WriteArray(LOD.Indices.AsView());
+	Writer.End();
+
+	Writer.BeginChunk("NORMALS", LOD.Normals.Num());
+	Writer.WriteArray(LOD.Normals.AsView());
+	Writer.End();
+
+	Writer.BeginChunk("TANGENTS", LOD.Tangents.Num());
+	Writer.WriteArray(LOD.Tangents.AsView());
+	Writer.End();
+
+	if (!LOD.VertexColors.IsEmpty())
+	{
+		Writer.BeginChunk("VERTEXCOLORS", LOD.VertexColors.Num());
+		for (const FVertexColorChunk& VertexColor : LOD.VertexColors)
+		{
+			Writer.WriteFString(Names.GetString(VertexColor.Name));
+			Writer.Write(VertexColor.Data.Num());
+			Writer.WriteArray(VertexColor.Data.AsView());
+		}
+		Writer.End();
+	}
+
+	Writer.BeginChunk("MATERIALS", LOD.Materials.Num());
+	for (const FMaterialChunk& Material : LOD.Materials)
+	{
+		Writer.WriteFString(Names.GetString(Material.Name));
+		Writer.WriteFString(Material.Path);
+		Writer.Write(Material.FirstIndex);
+		Writer.Write(Material.NumFaces);
+	}
+	Writer.End();
+
+	Writer.BeginChunk("TEXCOORDS", LOD.TextureCoordinates.Num());
+	for (const TUEFBulkData<FVector2f>& UVs : LOD.TextureCoordinates)
+	{
+		Writer.Write(UVs.Num());
+		Writer.WriteArray(UVs.AsView());
+	}
+	Writer.End();
+
+	if (!LOD.Weights.IsEmpty())
+	{
+		// Packed as 10 bytes per weight, written grouped by vertex as the reader stores them
+		Writer.BeginChunk("WEIGHTS", LOD.Weights.Num());
+		for (int32 VertexIndex = 0; VertexIndex < LOD.Weights.NumVertices(); VertexIndex++)
+		{
+			for (const FWeightChunk& Weight : LOD.Weights.GetVertexWeights(VertexIndex))
+			{
+				Writer.Write(Weight.WeightBoneIndex);
+				Writer.Write(VertexIndex);
+				Writer.Write(Weight.WeightAmount);
+			}
+		}
+		Writer.End();
+	}
+
+	if (!LOD.Morphs.IsEmpty())
+	{
+		Writer.BeginChunk("MORPHTARGETS", LOD.Morphs.Num());
+		for (const FMorphTargetChunk& Morph : LOD.Morphs)
+		{
+			Writer.WriteFString(Names.GetString(Morph.MorphName));
+			Writer.Write(Morph.MorphDeltas.Num());
+			Writer.WriteArray(Morph.MorphDeltas.AsView());
+		}
+		Writer.End();
+	}
+}
+
+void UEFModelWriter::WriteSkeleton(FUEFPayloadWriter& Writer, const FSkeletonData& Skeleton, const FUEFNameTable& Names)
+{
+	Writer.BeginChunk("METADATA", 1);
+	Writer.WriteFString(Skeleton.Path);
+	Writer.End();
+
+	Writer.BeginChunk("BONES", Skeleton.Bones.Num());
+	for (const FBoneChunk& Bone : Skeleton.Bones)
+	{
+		Writer.WriteFString(Names.GetString(Bone.BoneName));
+		Writer.Write(Bone.BoneParentIndex);
+		Writer.Write(Bone.BonePos);
+		Writer.Write(Bone.BoneRot);
+	}
+	Writer.End();
+
+	if (!Skeleton.Sockets.IsEmpty())
+	{
+		Writer.BeginChunk("SOCKETS", Skeleton.Sockets.Num());
+		for (const FSocketChunk& Socket : Skeleton.Sockets)
+		{
+			Writer.WriteFString(Names.GetString(Socket.SocketName));
+			Writer.WriteFString(Names.GetString(Socket.SocketParentName));
+			Writer.Write(Socket.SocketPos);
+			Writer.Write(Socket.SocketRot);
+			Writer.Write(Socket.SocketScale);
+		}
+		Writer.End();
+	}
+
+	if (!Skeleton.VirtualBones.IsEmpty())
+	{
+		Writer.BeginChunk("VIRTUALBONES", Skeleton.VirtualBones.Num());
+		for (const FVirtualBoneChunk& VirtualBone : Skeleton.VirtualBones)
+		{
+			Writer.WriteFString(Names.GetString(VirtualBone.SourceBoneName));
+			Writer.WriteFString(Names.GetString(VirtualBone.TargetBoneName));
+			Writer.WriteFString(Names.GetString(VirtualBone.VirtualBoneName));
+		}
+		Writer.End();
+	}
+}
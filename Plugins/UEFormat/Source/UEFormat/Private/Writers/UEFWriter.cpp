@@ -0,0 +1,184 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#include "Writers/UEFWriter.h"
+#include "Readers/UEFFileSource.h"
+#include "Readers/UEFModelReader.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "zstd.h"
+
+static const std::string GMAGIC = "UEFORMAT";
+
+void FUEFPayloadWriter::WriteFString(FAnsiStringView String)
+{
+	Write(String.Len());
+	Data.Append(reinterpret_cast<const uint8*>(String.GetData()), String.Len());
+}
+
+void FUEFPayloadWriter::BeginChunk(FAnsiStringView Name, int32 ArraySize)
+{
+	WriteFString(Name);
+	Write(ArraySize);
+	OpenSizes.Add(Data.Num());
+	Write(int32(0));
+}
+
+void FUEFPayloadWriter::BeginEntry(FAnsiStringView Name)
+{
+	WriteFString(Name);
+	OpenSizes.Add(Data.Num());
+	Write(int32(0));
+}
+
+void FUEFPayloadWriter::End()
+{
+	const int32 SizeOffset = OpenSizes.Pop();
+	const int32 ByteSize = Data.Num() - SizeOffset - static_cast<int32>(sizeof(int32));
+	FMemory::Memcpy(&Data[SizeOffset], &ByteSize, sizeof(ByteSize));
+}
+
+static void WriteFString(TArray<uint8>& Out, const std::string& String)
+{
+	const int32 Size = static_cast<int32>(String.size());
+	Out.Append(reinterpret_cast<const uint8*>(&Size), sizeof(Size));
+	Out.Append(reinterpret_cast<const uint8*>(String.data()), Size);
+}
+
+template<typename T>
+static void WriteData(TArray<uint8>& Out, const T& Data)
+{
+	Out.Append(reinterpret_cast<const uint8*>(&Data), sizeof(T));
+}
+
+// Appends the compressed payload to Out
+static FUEFWriteResult CompressZstd(TConstArrayView<uint8> Payload, const FUEFWriteOptions& Options, TArray<uint8>& Out)
+{
+	const size_t Bound = ZSTD_compressBound(Payload.Num());
+	if (Bound > static_cast<size_t>(MAX_int32 - Out.Num()))
+		return MakeError(FString::Printf(TEXT("payload of %d bytes is too large to compress"), Payload.Num()));
+
+	ZSTD_CCtx* Context = ZSTD_createCCtx();
+	if (!Context)
+		return MakeError(FString(TEXT("could not create a compression context")));
+
+	// With workers, ZSTD splits the payload into jobs compressed in parallel, the frame still decodes as one
+	size_t Result = ZSTD_CCtx_setParameter(Context, ZSTD_c_compressionLevel, Options.CompressionLevel);
+	if (!ZSTD_isError(Result) && Options.NumWorkers > 0)
+		Result = ZSTD_CCtx_setParameter(Context, ZSTD_c_nbWorkers, Options.NumWorkers);
+	// Referenced only, the frame header records the dictionary's ID for the readers
+	if (!ZSTD_isError(Result) && Options.Dictionary)
+		Result = ZSTD_CCtx_refCDict(Context, Options.Dictionary);
+
+	const int32 Offset = Out.AddUninitialized(static_cast<int32>(Bound));
+	if (!ZSTD_isError(Result))
+		Result = ZSTD_compress2(Context, Out.GetData() + Offset, Bound, Payload.GetData(), Payload.Num());
+	ZSTD_freeCCtx(Context);
+
+	if (ZSTD_isError(Result))
+	{
+		Out.SetNum(Offset);
+		return MakeError(FString::Printf(TEXT("compression failed: %hs"), ZSTD_getErrorName(Result)));
+	}
+	Out.SetNum(Offset + static_cast<int32>(Result));
+	return MakeValue();
+}
+
+FUEFWriteResult UEFWriteFile(const FString& Filename, const FUEFormatHeader& Header, TConstArrayView<uint8> Payload, const FUEFWriteOptions& Options)
+{
+	// Same header layout the readers parse
+	TArray<uint8> Out;
+	Out.Append(reinterpret_cast<const uint8*>(GMAGIC.data()), GMAGIC.size());
+	WriteFString(Out, Header.Identifier);
+	WriteData(Out, Header.FileVersionBytes);
+	WriteFString(Out, Header.ObjectName);
+	WriteData(Out, Options.bCompress);
+
+	if (Options.bCompress)
+	{
+		WriteFString(Out, "ZSTD");
+		WriteData(Out, Payload.Num());
+		// Compressed size, known once the payload has been compressed behind it
+		const int32 SizeOffset = Out.Num();
+		WriteData(Out, int32(0));
+		if (FUEFWriteResult Result = CompressZstd(Payload, Options, Out); Result.HasError())
+			return Result;
+		const int32 CompressedSize = Out.Num() - SizeOffset - static_cast<int32>(sizeof(int32));
+		FMemory::Memcpy(&Out[SizeOffset], &CompressedSize, sizeof(CompressedSize));
+	}
+	else
+		Out.Append(Payload.GetData(), Payload.Num());
+
+	if (!FFileHelper::SaveArrayToFile(Out, *Filename))
+		return MakeError(FString(TEXT("could not write the output file")));
+	return MakeValue();
+}
+
+FUEFReadResult UEFReadPayload(const FString& Filename, FUEFormatHeader& OutHeader, TArray<uint8>& OutPayload)
+{
+	FUEFFileSource Source(Filename, GetDefaultSourceMode());
+	if (FUEFReadResult Result = Source.ReadHeader(GMAGIC, OutHeader); Result.HasError()) return Result;
+	if (FUEFReadResult Result = Source.ReadPayload(OutHeader, false); Result.HasError()) return Result;
+
+	OutPayload.Append(reinterpret_cast<const uint8*>(Source.GetPayload()), Source.GetPayloadSize());
+	Source.Close();
+	return MakeValue();
+}
+
+FUEFWriteResult UEFRecompressFile(const FString& InFile, const FString& OutFile, const FUEFWriteOptions& Options)
+{
+	FUEFormatHeader Header;
+	FUEFFileSource Source(InFile, GetDefaultSourceMode());
+	if (FUEFReadResult Result = Source.ReadHeader(GMAGIC, Header); Result.HasError())
+		return MakeError(Result.GetError().ToString());
+	if (FUEFReadResult Result = Source.ReadPayload(Header, false); Result.HasError())
+		return MakeError(Result.GetError().ToString());
+
+	FUEFWriteResult Result = UEFWriteFile(OutFile, Header, MakeArrayView(reinterpret_cast<const uint8*>(Source.GetPayload()), Source.GetPayloadSize()), Options);
+	Source.Close();
+	return Result;
+}
+
+static void Recompress(const TArray<FString>& Args)
+{
+	if (Args.Num() < 2)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Usage: UEFormat.Recompress <SourceDir> <OutputDir> [Level=0] [Workers=0]"));
+		return;
+	}
+	const FString SourceDir = Args[0];
+	const FString OutputDir = Args[1];
+	FUEFWriteOptions Options;
+	Options.CompressionLevel = Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 0;
+	Options.NumWorkers = Args.Num() > 3 ? FMath::Max(FCString::Atoi(*Args[3]), 0) : 0;
+
+	TArray<FString> Files;
+	IFileManager::Get().FindFilesRecursive(Files, *SourceDir, TEXT("*.ueanim"), true, false);
+	IFileManager::Get().FindFilesRecursive(Files, *SourceDir, TEXT("*.uemodel"), true, false, false);
+	int32 NumWritten = 0;
+	int64 BytesIn = 0;
+	int64 BytesOut = 0;
+	for (const FString& File : Files)
+	{
+		FString RelativePath = File;
+		FPaths::MakePathRelativeTo(RelativePath, *FPaths::Combine(SourceDir, TEXT("")));
+		const FString OutFile = FPaths::Combine(OutputDir, RelativePath);
+		if (FUEFWriteResult Result = UEFRecompressFile(File, OutFile, Options); Result.HasError())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Could not recompress %s: %s"), *File, *Result.GetError());
+			continue;
+		}
+		++NumWritten;
+		BytesIn += IFileManager::Get().FileSize(*File);
+		BytesOut += IFileManager::Get().FileSize(*OutFile);
+	}
+	UE_LOG(LogTemp, Log, TEXT("Recompressed %d of %d files at level %d to %s: %lld bytes became %lld"),
+		NumWritten, Files.Num(), Options.CompressionLevel, *OutputDir, BytesIn, BytesOut);
+}
+
+static FAutoConsoleCommand RecompressCommand(
+	TEXT("UEFormat.Recompress"),
+	TEXT("Rewrites the UEFormat files below a directory with their payload ZSTD-compressed at the given level. ")
+	TEXT("Usage: UEFormat.Recompress <SourceDir> <OutputDir> [Level=0] [Workers=0]. Workers compress each file on that many threads."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&Recompress));
@@ -0,0 +1,26 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "UEFImportCommandlet.generated.h"
+
+// Imports .uemodel and .ueanim files without any UI, for unattended re-imports on build machines:
+//
+//   UnrealEditor-Cmd <Project> -run=UEFImport (-Source=<Dir> | -Manifest=<File>) -Dest=/Game/<Path>
+//       [-Skeleton=<Skeleton object path>] [-Workers=<N>] [-Report=<CSV file>] [-NoSave] -unattended -nullrhi
+//
+// Files are read and decoded by a pool of Workers threads while the game thread creates the assets, in file order.
+// A manifest lists one file per line, relative paths are resolved against the manifest's directory and lines starting
+// with # are skipped. Animations are imported onto -Skeleton. Timing and throughput are logged for every file and
+// optionally written to the -Report CSV. Returns non-zero if any file failed.
+UCLASS()
+class UEFORMAT_API UUEFImportCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UUEFImportCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
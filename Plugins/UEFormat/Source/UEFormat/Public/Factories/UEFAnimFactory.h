@@ -3,6 +3,7 @@
 #pragma once
 #include "CoreMinimal.h"
 #include "Factories/Factory.h"
+#include "Readers/UEFAnimReader.h"
 #include "Widgets/Anim/UEFAnimImportOptions.h"
 #include "UEFAnimFactory.generated.h"
 
@@ -17,5 +18,17 @@ class UEFORMAT_API UEFAnimFactory : public UFactory
 	bool bImport;
 	bool bImportAll;
 
+	// Sequences imported under "Apply to All". Their asset registry notifications and the global component
+	// reregistration are deferred until the batch ends in CleanUp, instead of running once per file.
+	UPROPERTY()
+	TArray<TObjectPtr<UObject>> PendingAssets;
+
 	virtual UObject* FactoryCreateFile(UClass* Class, UObject* Parent, FName Name, EObjectFlags Flags, const FString& Filename, const TCHAR* Params, FFeedbackContext* Warn, bool& bOutOperationCanceled) override;
+	virtual void CleanUp() override;
+
+	// Creates the sequence from a file that has already been read, e.g. on a worker thread. Game thread only.
+	// Uses SettingsImporter as it is, the options dialog is only shown by FactoryCreateFile.
+	UObject* ImportFromReader(UEFAnimReader& Data, UObject* Parent, FName Name, EObjectFlags Flags);
+
+	void FlushPendingAssets();
 };
\ No newline at end of file
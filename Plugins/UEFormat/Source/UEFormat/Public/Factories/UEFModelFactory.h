@@ -4,6 +4,7 @@
 #include "CoreMinimal.h"
 #include "Factories/Factory.h"
 #include "Readers/UEFModelReader.h"
+#include "Factories/UEFVertexInstanceMap.h"
 #include "Engine/StaticMesh.h"
 #include "Engine/SkeletalMesh.h"
 #include "Engine/SkinnedAssetCommon.h"
@@ -15,17 +16,23 @@ class UEFORMAT_API UEFModelFactory : public UFactory
 	GENERATED_UCLASS_BODY()
 
 	virtual UObject* FactoryCreateFile(UClass* Class, UObject* Parent, FName Name, EObjectFlags Flags, const FString& Filename, const TCHAR* Params, FFeedbackContext* Warn, bool& bOutOperationCanceled) override;
+	// Creates the mesh from a file that has already been read, e.g. on a worker thread. Game thread only.
+	UObject* ImportFromReader(UEFModelReader& Data, UObject* Parent, FName Name, EObjectFlags Flags);
 	
-	void PopulateMeshDescription(FMeshDescription& MeshDesc, FLODData& Data);
-	void SetMeshAttributes(FMeshDescription& MeshDesc, FLODData& Data);
-	void CreatePolygonGroups(FMeshDescription& MeshDesc, FLODData& Data);
+	// Creates the vertices and the vertex instances, welded per UEFormat.Import.WeldVertexInstances
+	void PopulateMeshDescription(FMeshDescription& MeshDesc, FLODData& Data, FUEFVertexInstanceMap& Instances);
+	void SetMeshAttributes(FMeshDescription& MeshDesc, FLODData& Data, const FUEFVertexInstanceMap& Instances);
+	void CreatePolygonGroups(FMeshDescription& MeshDesc, FLODData& Data, const FUEFVertexInstanceMap& Instances, const FUEFNameTable& Names);
 
-	void ProcessLOD(FMeshDescription& MeshDesc, FLODData& LODData);
+	// ProcessLOD and ProcessSkeletalLOD only write to MeshDesc, so different LODs can be processed on separate threads
+	void ProcessLOD(FMeshDescription& MeshDesc, FLODData& LODData, const FUEFNameTable& Names);
+	// Registers the skeletal attributes of a LOD built by ProcessLOD, then fills its bones, skin weights and morph targets
+	void ProcessSkeletalLOD(FMeshDescription& MeshDesc, FLODData& Data, const FReferenceSkeleton& RefSkeleton, const FUEFNameTable& Names);
 
-	TArray<FStaticMaterial> CreateStaticMaterials(TArray<FMaterialChunk> MaterialInfos);
-	TArray<FSkeletalMaterial> CreateSkeletalMaterials(TArray<FMaterialChunk> MaterialInfos);
+	TArray<FStaticMaterial> CreateStaticMaterials(TArray<FMaterialChunk> MaterialInfos, const FUEFNameTable& Names);
+	TArray<FSkeletalMaterial> CreateSkeletalMaterials(TArray<FMaterialChunk> MaterialInfos, const FUEFNameTable& Names);
 	
-	UStaticMesh* CreateStaticMesh(TArray<FLODData>& LODData, UObject* Parent, FName Name, EObjectFlags Flags);
-	USkeletalMesh* CreateSkeletalMesh(TArray<FLODData>& LODData, FSkeletonData& SkeletonData, UObject* Parent, FName Name, EObjectFlags Flags);
-	USkeleton* CreateSkeleton(FString Name, UObject* Parent, EObjectFlags Flags, FSkeletonData& Data, FReferenceSkeleton& RefSkeleton);
+	UStaticMesh* CreateStaticMesh(TArray<FLODData>& LODData, const FUEFNameTable& Names, UObject* Parent, FName Name, EObjectFlags Flags);
+	USkeletalMesh* CreateSkeletalMesh(TArray<FLODData>& LODData, FSkeletonData& SkeletonData, const FUEFNameTable& Names, UObject* Parent, FName Name, EObjectFlags Flags);
+	USkeleton* CreateSkeleton(FString Name, UObject* Parent, EObjectFlags Flags, FSkeletonData& Data, const FUEFNameTable& Names, FReferenceSkeleton& RefSkeleton);
 };
@@ -0,0 +1,10 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Readers/UEFModelReader.h"
+
+// Prepares a LOD's skin weights for FBoneWeights: vertices past Data.Vertices are dropped, every vertex keeps at most
+// MaxInfluences of its positive weights, strongest first (file order among equal weights), normalized to sum to one.
+// OutWeights covers every vertex up to the highest weighted one that exists.
+UEFORMAT_API void UEFLimitInfluences(const FLODData& Data, int32 MaxInfluences, FSkinWeightsData& OutWeights);
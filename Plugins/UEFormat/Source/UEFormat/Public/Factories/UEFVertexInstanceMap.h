@@ -0,0 +1,23 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Readers/UEFModelReader.h"
+
+// Maps a LOD's indices to the vertex instances created for them
+struct UEFORMAT_API FUEFVertexInstanceMap
+{
+	// Vertex of every instance, in instance order
+	TConstArrayView<int32> InstanceVertices;
+	// Instance of every index, empty when each index has an instance of its own
+	TArray<int32> IndexInstances;
+	// Backs InstanceVertices when instances were welded
+	TArray<int32> WeldedVertices;
+
+	// Every attribute of an instance is looked up through its vertex, so instances of the same vertex are identical
+	// and the vertex index alone is the weld key. Welded instances are numbered in order of first use, unwelded ones
+	// are the indices themselves. Data has to outlive the map, its indices must be within its vertices.
+	void Build(const FLODData& Data, bool bWeld);
+
+	int32 GetInstance(int32 Index) const { return IndexInstances.IsEmpty() ? Index : IndexInstances[Index]; }
+};
@@ -4,54 +4,53 @@
 #include <fstream>
 #include "UEFModelReader.h"
 #include "Containers/Array.h"
+#include "Containers/ArrayView.h"
 #include "Math/Quat.h"
 
-struct FFloatKey
+// Frame indices and values of one key stream, stored apart so each can be walked as a flat array.
+// Both are views into the arena of the reader that filled them and live as long as it does.
+template<typename T>
+struct TUEFKeyStream
 {
-	int32 Frame;
-	float FloatValue;
-};
-struct FVectorKey
-{
-	int32 Frame;
-	FVector3f VectorValue;
-};
-struct FQuatKey
-{
-	int32 Frame;
-	FQuat4f QuatValue;
+	TArrayView<int32> Frames;
+	TArrayView<T> Values;
+
+	int32 Num() const { return Frames.Num(); }
+	bool IsEmpty() const { return Frames.IsEmpty(); }
 };
 struct FCurve
 {
-	std::string CurveName;
-	TArray<FFloatKey> CurveKeys;
+	FUEFNameIndex CurveName;
+	TUEFKeyStream<float> Keys;
 };
 struct FTrack
 {
-	std::string TrackName;
-	TArray<FVectorKey> TrackPosKeys;
-	TArray<FQuatKey> TrackRotKeys;
-	TArray<FVectorKey> TrackScaleKeys;
+	FUEFNameIndex TrackName;
+	TUEFKeyStream<FVector3f> PosKeys;
+	TUEFKeyStream<FQuat4f> RotKeys;
+	TUEFKeyStream<FVector3f> ScaleKeys;
 };
 
 class UEFORMAT_API UEFAnimReader
 {
 public:
-	UEFAnimReader(const FString Filename);
+	UEFAnimReader(const FString Filename, EUEFSourceMode Mode = GetDefaultSourceMode());
 	~UEFAnimReader();
 	
-	bool Read();
+	FUEFReadResult Read();
 	
 	FUEFormatHeader Header;
 
 	int32 NumFrames;
 	float FramesPerSecond;
-	std::string RefPosePath;
+	FAnsiStringView RefPosePath;
 	EAdditiveAnimationType AdditiveAnimType;
 	EAdditiveBasePoseType RefPoseType;
 	int32 RefFrameIndex;
 	TArray<FTrack> Tracks;
 	TArray<FCurve> Curves;
+	// Track and curve names
+	FUEFNameTable Names;
 
 private:
 	const std::string GMAGIC = "UEFORMAT";
@@ -59,6 +58,13 @@ private:
 	const std::string ZSTD = "ZSTD";
 	const std::string ANIM_IDENTIFIER = "UEANIM";
 	
-	std::ifstream Ar;
-	void ReadBuffer(const char* Buffer, int BufferSize);
+	FUEFFileSource Source;
+
+	// Owns the ref pose path and key streams, all track keys and all curve keys are one allocation each
+	FUEFArena Arena;
+
+	void ReadBuffer(FUEFBufferCursor& Cursor);
+	void ReadStream(FUEFZstdStream& Stream);
+	void ReadChunk(const std::string& ChunkName, int32 ArraySize, FUEFBufferCursor& Chunk);
+	void ReadTrack(FUEFBufferCursor& Cursor, FTrack& Track);
 };
\ No newline at end of file
@@ -0,0 +1,43 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Containers/StringView.h"
+#include "HAL/CriticalSection.h"
+
+// Linear allocator for everything a reader parses out of one file. Allocations are never freed individually,
+// all blocks are released together when the arena is destroyed. Safe to allocate from several threads.
+class UEFORMAT_API FUEFArena
+{
+public:
+	explicit FUEFArena(int64 InBlockSize = 64 * 1024);
+	~FUEFArena();
+	FUEFArena(const FUEFArena&) = delete;
+	FUEFArena& operator=(const FUEFArena&) = delete;
+
+	// Uninitialized memory, valid until the arena is destroyed or reset.
+	void* Allocate(int64 Size, int32 Alignment);
+
+	template<typename T>
+	T* AllocateArray(int32 Num)
+	{
+		static_assert(std::is_trivially_destructible_v<T>, "arena memory is released without running destructors");
+		return static_cast<T*>(Allocate(static_cast<int64>(Num) * sizeof(T), alignof(T)));
+	}
+
+	// Copies Len characters and returns a view of the copy, which is not null terminated.
+	FAnsiStringView CopyString(const char* Data, int32 Len);
+
+	// Releases every block, all views handed out become invalid.
+	void Reset();
+
+	int64 GetAllocatedSize() const;
+
+private:
+	mutable FCriticalSection Lock;
+	TArray<uint8*> Blocks;
+	uint8* Next = nullptr;
+	uint8* End = nullptr;
+	int64 BlockSize;
+	int64 AllocatedSize = 0;
+};
@@ -0,0 +1,120 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include <string>
+#include "CoreMinimal.h"
+#include "Misc/Optional.h"
+#include "Templates/ValueOrError.h"
+
+struct FUEFReadError
+{
+    std::string ChunkName;
+    int64 Offset = 0;
+    FString Reason;
+
+    FString ToString() const
+    {
+        return FString::Printf(TEXT("%s at offset %lld: %s"), ChunkName.empty() ? TEXT("<file>") : UTF8_TO_TCHAR(ChunkName.c_str()), Offset, *Reason);
+    }
+};
+
+using FUEFReadResult = TValueOrError<void, FUEFReadError>;
+
+// Bounds-checked read position inside a payload. Every read is validated against End; the first failure is recorded
+// in the shared error and all further reads on this cursor (and any slice of it) become no-ops returning zeroed data.
+class FUEFBufferCursor
+{
+public:
+    FUEFBufferCursor(const char* InData, int32 InSize, TOptional<FUEFReadError>& InError, int64 InBaseOffset = 0)
+        : Base(InData), Ptr(InData), End(InData + InSize), BaseOffset(InBaseOffset), Error(InError) {}
+
+    bool IsError() const { return Error.IsSet(); }
+    bool IsAtEnd() const { return Ptr >= End; }
+    int32 GetOffset() const { return static_cast<int32>(Ptr - Base); }
+    int32 GetRemaining() const { return static_cast<int32>(End - Ptr); }
+    const char* GetData() const { return Ptr; }
+    const char* GetEnd() const { return End; }
+    const std::string& GetChunkName() const { return ChunkName; }
+
+    // Validates that Bytes can be read from the current position.
+    bool Require(int64 Bytes)
+    {
+        if (IsError())
+            return false;
+        if (Bytes < 0 || Bytes > End - Ptr)
+        {
+            SetError(FString::Printf(TEXT("needs %lld bytes, %d left"), Bytes, GetRemaining()));
+            return false;
+        }
+        return true;
+    }
+
+    // Validates a declared element count against the bytes left, given the smallest possible element size.
+    bool RequireCount(int64 Count, int64 MinElementSize)
+    {
+        if (IsError())
+            return false;
+        if (Count < 0 || Count * MinElementSize > End - Ptr)
+        {
+            SetError(FString::Printf(TEXT("count %lld does not fit in %d remaining bytes"), Count, GetRemaining()));
+            return false;
+        }
+        return true;
+    }
+
+    const char* Consume(int64 Bytes)
+    {
+        if (!Require(Bytes))
+            return nullptr;
+        const char* Result = Ptr;
+        Ptr += Bytes;
+        return Result;
+    }
+
+    // Splits off the next Bytes as a separate cursor for a nested chunk and advances past them.
+    FUEFBufferCursor Slice(int32 Bytes, const std::string& InChunkName)
+    {
+        FUEFBufferCursor Result(*this);
+        Result.ChunkName = ChunkName.empty() ? InChunkName : ChunkName + "/" + InChunkName;
+        if (!IsError() && (Bytes < 0 || Bytes > End - Ptr))
+            Result.SetError(FString::Printf(TEXT("declared size %d exceeds %d remaining bytes"), Bytes, GetRemaining()));
+        if (IsError())
+        {
+            Result.End = Result.Ptr;
+            return Result;
+        }
+        Ptr += Bytes;
+        Result.End = Result.Ptr + Bytes;
+        return Result;
+    }
+
+    void SetError(const FString& Reason)
+    {
+        if (!IsError())
+            Error.Emplace(FUEFReadError{ ChunkName, BaseOffset + GetOffset(), Reason });
+    }
+
+    // Records an error raised by a cursor that reported elsewhere, keeping its chunk and offset.
+    void SetError(const FUEFReadError& InError)
+    {
+        if (!IsError())
+            Error.Emplace(InError);
+    }
+
+    // Same range, position and name, reporting into InError, so slices can be decoded on separate threads.
+    FUEFBufferCursor WithError(TOptional<FUEFReadError>& InError) const
+    {
+        FUEFBufferCursor Result(Base, static_cast<int32>(End - Base), InError, BaseOffset);
+        Result.Ptr = Ptr;
+        Result.ChunkName = ChunkName;
+        return Result;
+    }
+
+private:
+    const char* Base;
+    const char* Ptr;
+    const char* End;
+    int64 BaseOffset;
+    std::string ChunkName;
+    TOptional<FUEFReadError>& Error;
+};
@@ -0,0 +1,80 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+
+// Read-only bulk array that either owns its elements or references memory owned by the reader
+// (e.g. a memory-mapped file). Referenced data stays valid for as long as the reader that produced it.
+template<typename T>
+struct TUEFBulkData
+{
+	TUEFBulkData() = default;
+
+	TUEFBulkData(const TUEFBulkData& Other) { *this = Other; }
+
+	TUEFBulkData(TUEFBulkData&& Other) { *this = MoveTemp(Other); }
+
+	TUEFBulkData& operator=(const TUEFBulkData& Other)
+	{
+		if (this != &Other)
+		{
+			Owned = Other.Owned;
+			View = Other.IsOwned() ? TConstArrayView<T>(Owned) : Other.View;
+		}
+		return *this;
+	}
+
+	TUEFBulkData& operator=(TUEFBulkData&& Other)
+	{
+		if (this != &Other)
+		{
+			const bool bOtherOwned = Other.IsOwned();
+			Owned = MoveTemp(Other.Owned);
+			View = bOtherOwned ? TConstArrayView<T>(Owned) : Other.View;
+			Other.View = TConstArrayView<T>();
+		}
+		return *this;
+	}
+
+	// Points at external memory. Falls back to a copy if the memory is not suitably aligned for T.
+	void Reference(const T* Data, int32 Num)
+	{
+		if (Num > 0 && reinterpret_cast<UPTRINT>(Data) % alignof(T) != 0)
+		{
+			FMemory::Memcpy(SetNumUninitialized(Num), Data, Num * sizeof(T));
+			return;
+		}
+		Owned.Empty();
+		View = TConstArrayView<T>(Data, Num);
+	}
+
+	// Allocates owned storage and returns it for the caller to fill.
+	T* SetNumUninitialized(int32 Num)
+	{
+		Owned.SetNumUninitialized(Num);
+		View = Owned;
+		return Owned.GetData();
+	}
+
+	void Empty()
+	{
+		Owned.Empty();
+		View = TConstArrayView<T>();
+	}
+
+	bool IsOwned() const { return View.GetData() == Owned.GetData() && Owned.Num() > 0; }
+
+	int32 Num() const { return View.Num(); }
+	bool IsEmpty() const { return View.Num() == 0; }
+	const T* GetData() const { return View.GetData(); }
+	const T& operator[](int32 Index) const { return View[Index]; }
+	TConstArrayView<T> AsView() const { return View; }
+
+	const T* begin() const { return View.GetData(); }
+	const T* end() const { return View.GetData() + View.Num(); }
+
+private:
+	TArray<T> Owned;
+	TConstArrayView<T> View;
+};
@@ -0,0 +1,62 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/SharedPointer.h"
+
+struct ZSTD_DCtx_s;
+
+// Thread-safe pool of ZSTD decompression contexts, so batch imports don't create and free one per file.
+// Shared by FUEFormatModule and every borrowed context, so the pool lives until the last borrow has come back even
+// when the module shuts down first. Readers borrow a context for the duration of a decompression.
+class UEFORMAT_API FUEFDCtxPool : public TSharedFromThis<FUEFDCtxPool>
+{
+public:
+	struct FStats
+	{
+		int64 Hits = 0;
+		int64 Misses = 0;
+		int32 Pooled = 0;
+		int32 InUse = 0;
+	};
+
+	// Borrowed context, returned to the pool on destruction. Without a pool it owns a private context instead.
+	class UEFORMAT_API FScopedContext
+	{
+	public:
+		explicit FScopedContext(TSharedPtr<FUEFDCtxPool> InPool);
+		~FScopedContext();
+		FScopedContext(const FScopedContext&) = delete;
+		FScopedContext& operator=(const FScopedContext&) = delete;
+
+		ZSTD_DCtx_s* Get() const { return Context; }
+
+	private:
+		TSharedPtr<FUEFDCtxPool> Pool;
+		ZSTD_DCtx_s* Context;
+	};
+
+	explicit FUEFDCtxPool(int32 InMaxPooled = 64);
+	~FUEFDCtxPool();
+
+	// Borrows from the module's pool, or from a private context when the module isn't loaded.
+	static FScopedContext AcquireShared();
+
+	// The pool has to be owned by a TSharedPtr
+	FScopedContext Acquire() { return FScopedContext(AsShared()); }
+
+	FStats GetStats() const;
+
+	// Frees every pooled context. Borrowed contexts are freed when they come back.
+	void Trim();
+
+private:
+	mutable FCriticalSection Lock;
+	TArray<ZSTD_DCtx_s*> FreeContexts;
+	int32 MaxPooled;
+	FStats Stats;
+
+	ZSTD_DCtx_s* Pop();
+	void Push(ZSTD_DCtx_s* Context);
+};
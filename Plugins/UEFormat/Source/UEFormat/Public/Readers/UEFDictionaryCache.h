@@ -0,0 +1,37 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+struct ZSTD_DDict_s;
+
+// Digested ZSTD dictionaries keyed by dictionary ID. Frames compressed against a dictionary carry its ID in the frame
+// header, readers look it up here so the dictionary tables are built once per session instead of once per file.
+// Shared by FUEFormatModule with the readers using it. Entries are never removed, so pointers returned by Find stay valid
+// for as long as the cache is held.
+class UEFORMAT_API FUEFDictionaryCache
+{
+public:
+	~FUEFDictionaryCache();
+
+	// Digests a ZSTD dictionary and returns its ID, or 0 if the data is not a dictionary in ZSTD format.
+	uint32 Add(const TArray<uint8>& Dictionary);
+
+	// Adds every *.zdict file in Directory, returns the number of dictionaries added.
+	int32 LoadDirectory(const FString& Directory);
+
+	ZSTD_DDict_s* Find(uint32 DictID) const;
+	int32 Num() const;
+
+	// Looks the ID up in the module's cache, null when it is not loaded or the module isn't. OutCache holds the cache,
+	// keep it until the dictionary is no longer referenced.
+	static ZSTD_DDict_s* FindShared(uint32 DictID, TSharedPtr<FUEFDictionaryCache>& OutCache);
+
+	// Resources/Dictionaries inside the plugin, loaded on module startup.
+	static FString GetDefaultDirectory();
+
+private:
+	mutable FCriticalSection Lock;
+	TMap<uint32, ZSTD_DDict_s*> Dictionaries;
+};
@@ -0,0 +1,68 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include <fstream>
+#include <vector>
+#include "CoreMinimal.h"
+#include "Templates/UniquePtr.h"
+#include "UEFBufferCursor.h"
+#include "UEFZstdStream.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+struct FUEFormatHeader;
+
+enum class EUEFSourceMode : uint8
+{
+	Stream,			// read through std::ifstream into an owned buffer
+	MemoryMapped	// parse straight from a read-only mapping of the file
+};
+
+// Returns the mode selected by UEFormat.Import.MemoryMapped.
+UEFORMAT_API EUEFSourceMode GetDefaultSourceMode();
+
+// Whether Bytes of independent chunks or tracks are worth processing on worker threads, per UEFormat.Import.ParallelDecodeThresholdKB.
+UEFORMAT_API bool ShouldDecodeInParallel(int64 Bytes);
+
+// Opens a UEFormat file, reads its header and exposes the uncompressed payload as one contiguous block.
+class UEFORMAT_API FUEFFileSource
+{
+public:
+	FUEFFileSource(const FString& Filename, EUEFSourceMode InMode);
+	~FUEFFileSource();
+
+	FUEFReadResult ReadHeader(const std::string& Magic, FUEFormatHeader& Header);
+	// Large ZSTD payloads are handed out as a stream instead, unless the caller needs random access.
+	FUEFReadResult ReadPayload(const FUEFormatHeader& Header, bool bAllowStreaming = true);
+
+	const char* GetPayload() const { return Payload; }
+	int32 GetPayloadSize() const { return PayloadSize; }
+
+	// True if the payload stays valid until the source is destroyed, so parsed data may reference it.
+	bool IsPayloadPersistent() const { return Mode == EUEFSourceMode::MemoryMapped && !Stream.IsValid(); }
+
+	// Set instead of a payload when the file is large enough to be decompressed incrementally.
+	FUEFZstdStream* GetStream() const { return Stream.Get(); }
+
+	// Releases the file. Non-persistent payloads are released as well.
+	void Close();
+
+private:
+	EUEFSourceMode Mode;
+
+	std::ifstream Ar;
+
+	TUniquePtr<IMappedFileHandle> MappedHandle;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+	const char* MappedData = nullptr;
+	int64 MappedSize = 0;
+	int32 MappedOffset = 0;
+
+	TUniquePtr<FUEFZstdStream> Stream;
+
+	std::vector<char> PayloadStorage;
+	const char* Payload = nullptr;
+	int32 PayloadSize = 0;
+
+	FUEFReadResult Decompress(const FUEFormatHeader& Header, const char* CompressedData);
+};
@@ -4,10 +4,16 @@
 #include <fstream>
 #include "Math/Quat.h"
 #include "Containers/Array.h"
+#include "Templates/Function.h"
+#include "UEFArena.h"
+#include "UEFBufferCursor.h"
+#include "UEFNameTable.h"
+#include "UEFBulkData.h"
+#include "UEFFileSource.h"
 
 template<typename T>
 T ReadData(std::ifstream& Ar) {
-    T Data;
+    T Data{};
     Ar.read(reinterpret_cast<char*>(&Data), sizeof(T));
 
     return Data;
@@ -18,54 +24,90 @@ std::string ReadString(std::ifstream& Ar, int32 Size);
 std::string ReadFString(std::ifstream& Ar);
 
 template<typename T>
-T ReadBufferData(const char* DataArray, int& Offset) {
-    T Data;
-    std::memcpy(&Data, &DataArray[Offset], sizeof(T));
-    Offset += sizeof(T);
+T ReadBufferData(FUEFBufferCursor& Cursor) {
+    T Data{};
+    if (const char* Src = Cursor.Consume(sizeof(T)))
+        std::memcpy(&Data, Src, sizeof(T));
     return Data;
 }
 
+// Array readers validate the whole chunk once, then copy without further checks
 template<typename T>
-void ReadBufferArray(const char* DataArray, int& Offset, int ArraySize, TArray<T>& Data) {
-    Data.SetNum(ArraySize);
-    for (auto i = 0; i < ArraySize; i++) {
-        std::memcpy(&Data[i], &DataArray[Offset], sizeof(T));
-        Offset += sizeof(T);
+void ReadBufferArray(FUEFBufferCursor& Cursor, int ArraySize, TArray<T>& Data) {
+    const char* Src = Cursor.RequireCount(ArraySize, sizeof(T)) ? Cursor.Consume(ArraySize * sizeof(T)) : nullptr;
+    if (!Src)
+        return;
+    static_assert(std::is_trivially_copyable_v<T>, "ReadBufferArray copies raw bytes");
+    Data.SetNumUninitialized(ArraySize);
+    std::memcpy(Data.GetData(), Src, ArraySize * sizeof(T));
+}
+
+// Points into the payload when it outlives the reader's use of it, otherwise (or when misaligned) copies into the arena
+template<typename T>
+void ReadBufferBulk(FUEFBufferCursor& Cursor, int ArraySize, TUEFBulkData<T>& Data, FUEFArena& Arena, bool bReference) {
+    const char* Src = Cursor.RequireCount(ArraySize, sizeof(T)) ? Cursor.Consume(ArraySize * sizeof(T)) : nullptr;
+    if (!Src)
+        return;
+    if (ArraySize > 0 && (!bReference || reinterpret_cast<UPTRINT>(Src) % alignof(T) != 0))
+    {
+        T* Copy = Arena.AllocateArray<T>(ArraySize);
+        std::memcpy(Copy, Src, ArraySize * sizeof(T));
+        Src = reinterpret_cast<const char*>(Copy);
     }
+    Data.Reference(reinterpret_cast<const T*>(Src), ArraySize);
 }
 
-FQuat4f ReadBufferQuat(const char* DataArray, int& Offset);
+FQuat4f ReadBufferQuat(FUEFBufferCursor& Cursor);
+
+std::string ReadBufferString(FUEFBufferCursor& Cursor, int32 Size);
+
+std::string ReadBufferFString(FUEFBufferCursor& Cursor);
 
-std::string ReadBufferString(const char* DataArray, int& Offset, int32 Size);
+// Reads a length prefixed string into the arena, the view lives as long as the arena
+FAnsiStringView ReadBufferStringView(FUEFBufferCursor& Cursor, FUEFArena& Arena);
 
-std::string ReadBufferFString(const char* DataArray, int& Offset);
+// Reads a length prefixed string and interns it, INDEX_NONE if the read failed. Names of NAME_SIZE characters or more
+// fail the read, FName can't hold them.
+FUEFNameIndex ReadBufferName(FUEFBufferCursor& Cursor, FUEFNameTable& Names);
 
 struct FVertexColorChunk {
-    std::string Name;
+    FUEFNameIndex Name;
     int32 Count;
-    TArray<FColor> Data;
+    TUEFBulkData<FColor> Data;
 };
 struct FWeightChunk {
     short WeightBoneIndex;
-    int32 WeightVertexIndex;
     float WeightAmount;
 };
+// Skin weights grouped by vertex: the weights of vertex V are Weights[Offsets[V]] up to Weights[Offsets[V + 1]], in
+// file order. Offsets has one entry per vertex up to the highest weighted one, plus one.
+struct FSkinWeightsData {
+    TArray<int32> Offsets;
+    TArray<FWeightChunk> Weights;
+
+    int32 Num() const { return Weights.Num(); }
+    bool IsEmpty() const { return Weights.IsEmpty(); }
+    int32 NumVertices() const { return FMath::Max(Offsets.Num() - 1, 0); }
+    TConstArrayView<FWeightChunk> GetVertexWeights(int32 VertexIndex) const {
+        return MakeArrayView(Weights.GetData() + Offsets[VertexIndex], Offsets[VertexIndex + 1] - Offsets[VertexIndex]);
+    }
+};
 struct FBoneChunk {
-    std::string BoneName;
+    FUEFNameIndex BoneName;
     int32 BoneParentIndex;
     FVector3f BonePos;
     FQuat4f BoneRot;
 };
 struct FSocketChunk {
-    std::string SocketName;
-    std::string SocketParentName;
+    FUEFNameIndex SocketName;
+    FUEFNameIndex SocketParentName;
     FVector3f SocketPos;
     FQuat4f SocketRot;
     FVector3f SocketScale;
 };
 struct FMaterialChunk {
-    std::string Name;
-    std::string Path;
+    FUEFNameIndex Name;
+    FAnsiStringView Path;
     int32 FirstIndex;
     int32 NumFaces;
 };
@@ -75,13 +117,13 @@ struct FMorphTargetDataChunk {
     int32 MorphVertexIndex;
 };
 struct FMorphTargetChunk {
-    std::string MorphName;
-    TArray<FMorphTargetDataChunk> MorphDeltas;
+    FUEFNameIndex MorphName;
+    TUEFBulkData<FMorphTargetDataChunk> MorphDeltas;
 };
 struct FVirtualBoneChunk {
-    std::string SourceBoneName;
-    std::string TargetBoneName;
-    std::string VirtualBoneName;
+    FUEFNameIndex SourceBoneName;
+    FUEFNameIndex TargetBoneName;
+    FUEFNameIndex VirtualBoneName;
 };
 struct FUEFormatHeader {
     std::string Identifier;
@@ -93,18 +135,27 @@ struct FUEFormatHeader {
     int32 UncompressedSize;
 };
 struct FLODData {
-    TArray<FVector3f> Vertices;
-    TArray<int32> Indices;
-    TArray<FVector4f> Normals;
-    TArray<FVector3f> Tangents;
+    TUEFBulkData<FVector3f> Vertices;
+    TUEFBulkData<int32> Indices;
+    TUEFBulkData<FVector4f> Normals;
+    TUEFBulkData<FVector3f> Tangents;
     TArray<FVertexColorChunk> VertexColors;
-    TArray<TArray<FVector2f>> TextureCoordinates;
+    TArray<TUEFBulkData<FVector2f>> TextureCoordinates;
     TArray<FMaterialChunk> Materials;
-    TArray<FWeightChunk> Weights;
+    FSkinWeightsData Weights;
     TArray<FMorphTargetChunk> Morphs;
 };
+// Where a chunk lives in the payload, recorded by the index pass without decoding it
+struct FUEFChunkEntry {
+    std::string Name;
+    std::string Path;   // e.g. "LODS/LOD0/VERTICES", used in read errors
+    int32 LODIndex;     // INDEX_NONE for skeleton chunks
+    int32 ArraySize;
+    int32 Offset;       // of the chunk data, from the start of the payload
+    int32 ByteSize;
+};
 struct FSkeletonData {
-    std::string Path;
+    FAnsiStringView Path;
     TArray<FBoneChunk> Bones;
     TArray<FSocketChunk> Sockets;
     TArray<FVirtualBoneChunk> VirtualBones;
@@ -112,21 +163,53 @@ struct FSkeletonData {
 
 class UEFORMAT_API UEFModelReader {
 public:
-    UEFModelReader(const FString Filename);
+    UEFModelReader(const FString Filename, EUEFSourceMode Mode = GetDefaultSourceMode());
     ~UEFModelReader();
     
-    bool Read();
+    // Decodes the whole file. Fails if a LOD's chunks disagree, so the factories can index them without checks.
+    FUEFReadResult Read();
+
+    // Indexes the file without decoding any chunk, the payload stays loaded until the reader is destroyed.
+    // LODs is sized to the LOD count but stays empty until ReadLOD or ReadChunk fills it.
+    FUEFReadResult Open();
+    // Like Read, validates the LOD once it is decoded. ReadChunk doesn't, the rest of the LOD may still be missing.
+    FUEFReadResult ReadLOD(int32 LODIndex);
+    FUEFReadResult ReadSkeletonOnly();
+    // Decodes every chunk with this name, LODIndex selects the LOD for LOD chunks and is ignored otherwise.
+    FUEFReadResult ReadChunk(const std::string& ChunkName, int32 LODIndex = INDEX_NONE);
+
+    const TArray<FUEFChunkEntry>& GetTableOfContents() const { return TableOfContents; }
     
     FUEFormatHeader Header;
     TArray<FLODData> LODs;
     FSkeletonData Skeleton;
+    // Every bone, socket, material, morph target and vertex color name in LODs and Skeleton
+    FUEFNameTable Names;
 
 private:
+    // Owns the paths and copied bulk arrays in LODs and Skeleton, released with the reader
+    FUEFArena Arena;
+
     const std::string GMAGIC = "UEFORMAT";
     const std::string GZIP = "GZIP";
     const std::string ZSTD = "ZSTD";
     
-    std::ifstream Ar;
-    void ReadBuffer(const char* Buffer, int32 BufferSize);
-    void ReadChunks(const char* Buffer, int& Offset, int32 ByteSize, int LODIndex);
+    FUEFFileSource Source;
+    bool bReferencePayload = false;
+    bool bIndexed = false;
+    bool bHasDuplicateChunks = false;
+    // A vertex takes 12 bytes of the payload, so no valid weight refers to a vertex at or past this
+    int32 VertexIndexLimit = 0;
+    TArray<FUEFChunkEntry> TableOfContents;
+
+    FUEFReadResult OpenSource(bool bAllowStreaming);
+    FUEFReadResult BuildIndex();
+    void IndexChunks(FUEFBufferCursor& Cursor, int32 LODIndex);
+    FUEFReadResult ReadEntries(TFunctionRef<bool(const FUEFChunkEntry&)> Filter);
+    // Checks that a decoded LOD's chunks agree with each other, e.g. that its indices are within its vertices
+    FUEFReadResult ValidateLODs() const;
+    FUEFReadResult ValidateLOD(int32 LODIndex) const;
+    void ReadStream(FUEFZstdStream& Stream);
+    void ReadChunks(FUEFBufferCursor& Cursor, int32 LODIndex);
+    void ReadChunk(const std::string& ChunkName, int32 ArraySize, FUEFBufferCursor& Chunk, int32 LODIndex);
 };
\ No newline at end of file
@@ -0,0 +1,40 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Containers/StringView.h"
+#include "HAL/CriticalSection.h"
+#include "UEFArena.h"
+
+// Index of a name in the FUEFNameTable of the reader that parsed it
+using FUEFNameIndex = int32;
+
+// Names read from one file. Every distinct name is stored and converted to FName once, repeated names map to the
+// same index. Names are compared case sensitively so the casing of the file is kept.
+class UEFORMAT_API FUEFNameTable
+{
+public:
+	FUEFNameTable() : Strings(4 * 1024) {}
+
+	// Safe to call from several threads. Data does not have to outlive the call, Len has to be below NAME_SIZE.
+	FUEFNameIndex Add(const char* Data, int32 Len);
+
+	// Lookups are not synchronized with Add, use them once reading has finished.
+	FName Get(FUEFNameIndex Index) const { return Names.IsValidIndex(Index) ? Names[Index] : NAME_None; }
+	FAnsiStringView GetString(FUEFNameIndex Index) const { return Views.IsValidIndex(Index) ? Views[Index] : FAnsiStringView(); }
+
+	int32 Num() const { return Names.Num(); }
+
+private:
+	struct FCaseSensitiveKeyFuncs : TDefaultMapKeyFuncs<FAnsiStringView, FUEFNameIndex, false>
+	{
+		static bool Matches(FAnsiStringView A, FAnsiStringView B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+		static uint32 GetKeyHash(FAnsiStringView Key) { return FCrc::MemCrc32(Key.GetData(), Key.Len()); }
+	};
+
+	FCriticalSection Lock;
+	FUEFArena Strings;
+	TArray<FName> Names;
+	TArray<FAnsiStringView> Views;
+	TMap<FAnsiStringView, FUEFNameIndex, FDefaultSetAllocator, FCaseSensitiveKeyFuncs> Lookup;
+};
@@ -0,0 +1,78 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include <fstream>
+#include <vector>
+#include "CoreMinimal.h"
+#include "UEFBufferCursor.h"
+#include "UEFDCtxPool.h"
+
+class FUEFDictionaryCache;
+
+// Incrementally decompresses a ZSTD payload into a bounded window, so chunks can be parsed as soon as they are
+// complete instead of after the whole file has been inflated. The window only grows to the largest unit that is
+// requested in one piece, consumed bytes are discarded whenever more data is needed.
+class UEFORMAT_API FUEFZstdStream
+{
+public:
+	// Compressed data already in memory, e.g. a mapped file
+	FUEFZstdStream(const char* InCompressed, int32 InCompressedSize, int32 InUncompressedSize);
+	// Compressed data read from Ar in blocks as decompression progresses
+	FUEFZstdStream(std::ifstream& InAr, int32 InCompressedSize, int32 InUncompressedSize);
+
+	bool IsAtEnd() const { return Consumed >= UncompressedSize || Error.IsSet(); }
+	int64 GetOffset() const { return Consumed; }
+	int32 GetPeakWindowSize() const { return static_cast<int32>(Window.size()); }
+	TOptional<FUEFReadError>& GetError() { return Error; }
+
+	// Returns a cursor over the next Bytes of the payload and consumes them.
+	// The cursor is only valid until the next call on this stream.
+	FUEFBufferCursor ReadSlice(int32 Bytes, const std::string& ChunkName);
+
+	template<typename T>
+	T Read()
+	{
+		T Data{};
+		if (Fill(sizeof(T)))
+		{
+			std::memcpy(&Data, Window.data() + ReadPos, sizeof(T));
+			Advance(sizeof(T));
+		}
+		return Data;
+	}
+
+	std::string ReadFString();
+
+	void Skip(int32 Bytes);
+
+	void SetError(const FString& Reason);
+
+private:
+	// Holds the dictionary the context references, declared first so it is released after the context
+	TSharedPtr<FUEFDictionaryCache> Dictionaries;
+	FUEFDCtxPool::FScopedContext Context;
+
+	// Input
+	std::ifstream* Ar = nullptr;
+	std::vector<char> InputBuffer;
+	const char* InputData = nullptr;
+	int32 InputSize = 0;
+	int32 InputPos = 0;
+	int32 CompressedLeft = 0;
+
+	// Output window, [ReadPos, Filled) is decompressed but not yet consumed
+	std::vector<char> Window;
+	int32 ReadPos = 0;
+	int32 Filled = 0;
+
+	int32 UncompressedSize = 0;
+	int64 Consumed = 0;
+	bool bFrameStarted = false;
+	TOptional<FUEFReadError> Error;
+
+	void Init(int32 InUncompressedSize);
+	bool Fill(int32 Bytes);
+	bool StartFrame();
+	bool RefillInput();
+	void Advance(int32 Bytes) { ReadPos += Bytes; Consumed += Bytes; }
+};
@@ -2,11 +2,26 @@
 
 #pragma once
 #include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
 #include "Modules/ModuleManager.h"
+#include "Readers/UEFDCtxPool.h"
+#include "Readers/UEFDictionaryCache.h"
 
 class FUEFormatModule : public IModuleInterface
 {
 public:
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
+
+	// Decompression contexts shared by all readers, null while the module is not started. Borrowed contexts keep the
+	// pool alive past ShutdownModule.
+	static TSharedPtr<FUEFDCtxPool> GetDCtxPool();
+	// Dictionaries for frames compressed against a trained dictionary, null while the module is not started. Hold the
+	// cache for as long as a context references one of its dictionaries, it is freed with the last holder.
+	static TSharedPtr<FUEFDictionaryCache> GetDictionaries();
+
+private:
+	TSharedPtr<FUEFDCtxPool> DCtxPool;
+	TSharedPtr<FUEFDictionaryCache> Dictionaries;
+	TUniquePtr<FAutoConsoleCommand> DCtxPoolStatsCommand;
 };
@@ -4,6 +4,15 @@
 #include "CoreMinimal.h"
 #include "UEFAnimImportOptions.generated.h"
 
+UENUM()
+enum class EUEFAnimInterpolation : uint8
+{
+	// Hold each key's value until the next key
+	Step,
+	// Lerp positions and scales, slerp rotations
+	Linear,
+};
+
 UCLASS(config = Engine, defaultconfig, transient)
 class UEFORMAT_API UEFAnimImportOptions : public UObject
 {
@@ -12,5 +21,8 @@ public:
 	UEFAnimImportOptions();
 	UPROPERTY( EditAnywhere, Category = "Import Settings")
 	TObjectPtr<USkeleton> Skeleton;
+	/** How frames between two sparse keys are filled. Step holds each key as imports always have, Linear is opt-in */
+	UPROPERTY(EditAnywhere, Category = "Import Settings")
+	EUEFAnimInterpolation Interpolation;
 	bool bInitialized;
 };
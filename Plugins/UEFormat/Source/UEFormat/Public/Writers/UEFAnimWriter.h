@@ -0,0 +1,20 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "Readers/UEFAnimReader.h"
+#include "UEFWriter.h"
+
+// Serializes an animation back to a .ueanim, in the chunk layout UEFAnimReader parses.
+class UEFORMAT_API UEFAnimWriter
+{
+public:
+	UEFAnimWriter(const FString InFilename, const FUEFWriteOptions& InOptions = FUEFWriteOptions());
+
+	// Writes what Anim has read, including any edits made to its metadata, tracks and curves since. Track keys are
+	// reduced per the tolerances in the options, Anim itself is not changed.
+	FUEFWriteResult Write(const UEFAnimReader& Anim);
+
+private:
+	FString Filename;
+	FUEFWriteOptions Options;
+};
@@ -0,0 +1,51 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Templates/ValueOrError.h"
+
+struct ZSTD_CDict_s;
+
+struct FUEFDictionaryTrainingStats
+{
+	int32 NumSamples = 0;
+	int64 SampleBytes = 0;
+	int64 CompressedBytes = 0;
+	int64 DictCompressedBytes = 0;
+};
+
+// Trains a ZSTD dictionary over the payloads of existing .uemodel/.ueanim files and rewrites files against it.
+// Small files share chunk tags, bone names and identity keys that a single frame is too short to learn on its own,
+// a dictionary supplies them up front. Run through the UEFormat.TrainDictionary console command.
+class UEFORMAT_API FUEFDictionaryTrainer
+{
+public:
+	// 0 selects ZSTD's default compression level
+	explicit FUEFDictionaryTrainer(int32 InCompressionLevel = 0);
+	~FUEFDictionaryTrainer();
+
+	// Adds the uncompressed payload of a UEFormat file as a training sample.
+	bool AddFile(const FString& Filename, FString& OutError);
+	// Adds every .uemodel/.ueanim below Directory, returns the number of samples added.
+	int32 AddDirectory(const FString& Directory);
+	int32 GetNumSamples() const { return SampleSizes.Num(); }
+
+	// Trains on all samples added so far and returns the dictionary ID.
+	TValueOrError<uint32, FString> Train(int32 MaxDictionarySize);
+	const TArray<uint8>& GetDictionary() const { return Dictionary; }
+
+	// Compresses every sample with and without the trained dictionary.
+	FUEFDictionaryTrainingStats Evaluate() const;
+
+	// Writes a copy of InFile with its payload ZSTD-compressed against the trained dictionary.
+	bool CompressFile(const FString& InFile, const FString& OutFile, FString& OutError) const;
+
+private:
+	int32 CompressionLevel;
+
+	TArray<uint8> SampleData;
+	TArray<size_t> SampleSizes;
+
+	TArray<uint8> Dictionary;
+	ZSTD_CDict_s* CDict = nullptr;
+};
@@ -0,0 +1,24 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "Readers/UEFModelReader.h"
+#include "UEFWriter.h"
+
+// Serializes LOD and skeleton data back to a .uemodel, in the chunk layout UEFModelReader parses.
+class UEFORMAT_API UEFModelWriter
+{
+public:
+	UEFModelWriter(const FString InFilename, const FUEFWriteOptions& InOptions = FUEFWriteOptions());
+
+	// Names are resolved through Names. Header supplies the identifier, version and object name.
+	FUEFWriteResult Write(const FUEFormatHeader& Header, TConstArrayView<FLODData> LODs, const FSkeletonData& Skeleton, const FUEFNameTable& Names);
+	// Writes what Model has read, including any edits made to its LODs and Skeleton since.
+	FUEFWriteResult Write(const UEFModelReader& Model);
+
+private:
+	FString Filename;
+	FUEFWriteOptions Options;
+
+	void WriteLOD(FUEFPayloadWriter& Writer, const FLODData& LOD, const FUEFNameTable& Names);
+	void WriteSkeleton(FUEFPayloadWriter& Writer, const FSkeletonData& Skeleton, const FUEFNameTable& Names);
+};
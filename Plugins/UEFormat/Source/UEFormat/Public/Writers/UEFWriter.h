@@ -0,0 +1,79 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Containers/StringView.h"
+#include "Templates/ValueOrError.h"
+#include "Readers/UEFBufferCursor.h"
+#include "Widgets/Anim/UEFAnimImportOptions.h"
+
+struct FUEFormatHeader;
+struct ZSTD_CDict_s;
+
+using FUEFWriteResult = TValueOrError<void, FString>;
+
+struct FUEFWriteOptions
+{
+	// Writes the payload uncompressed when false
+	bool bCompress = true;
+	// ZSTD level, 0 selects ZSTD's default. Negative levels compress less and decode fastest.
+	int32 CompressionLevel = 0;
+	// ZSTD worker threads, 0 compresses on the calling thread
+	int32 NumWorkers = 0;
+	// Digested dictionary to compress against, null for none. Its compression level takes precedence over
+	// CompressionLevel. Readers need the same dictionary in the module's FUEFDictionaryCache to decode the file.
+	const ZSTD_CDict_s* Dictionary = nullptr;
+
+	// UEFAnimWriter drops track keys that the kept keys reproduce within these tolerances, negative keeps every key.
+	// Positions and scales are measured as distance, rotations as an angle in degrees. Curves are written as read.
+	float PositionTolerance = -1.0f;
+	float RotationTolerance = -1.0f;
+	float ScaleTolerance = -1.0f;
+	// How the written keys will be interpolated on import, which decides what the kept keys reproduce
+	EUEFAnimInterpolation KeyInterpolation = EUEFAnimInterpolation::Step;
+};
+
+// Builds a UEFormat payload. Chunks are a name, an element count and a byte size followed by their data, LOD entries
+// of the LODS chunk only have the name and byte size. Sizes are patched in when the chunk or entry ends.
+class UEFORMAT_API FUEFPayloadWriter
+{
+public:
+	template<typename T>
+	void Write(const T& Value)
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "Write copies raw bytes");
+		Data.Append(reinterpret_cast<const uint8*>(&Value), sizeof(T));
+	}
+
+	template<typename T>
+	void WriteArray(TConstArrayView<T> Values)
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "WriteArray copies raw bytes");
+		Data.Append(reinterpret_cast<const uint8*>(Values.GetData()), Values.Num() * sizeof(T));
+	}
+
+	void WriteFString(FAnsiStringView String);
+
+	void BeginChunk(FAnsiStringView Name, int32 ArraySize);
+	void BeginEntry(FAnsiStringView Name);
+	// Ends the innermost open chunk or entry
+	void End();
+
+	TConstArrayView<uint8> GetData() const { check(OpenSizes.IsEmpty()); return Data; }
+
+private:
+	TArray<uint8> Data;
+	// Offsets of the byte sizes still to be patched
+	TArray<int32> OpenSizes;
+};
+
+// Writes Header and Payload to Filename, compressing the payload per Options. The compression fields of Header are
+// ignored and written from the result.
+UEFORMAT_API FUEFWriteResult UEFWriteFile(const FString& Filename, const FUEFormatHeader& Header, TConstArrayView<uint8> Payload, const FUEFWriteOptions& Options);
+
+// Reads the header and the decompressed payload of a .uemodel/.ueanim, for writing it back out
+UEFORMAT_API FUEFReadResult UEFReadPayload(const FString& Filename, FUEFormatHeader& OutHeader, TArray<uint8>& OutPayload);
+
+// Rewrites a .uemodel/.ueanim with its payload recompressed per Options. The payload is copied as is, chunks the
+// readers don't know survive.
+UEFORMAT_API FUEFWriteResult UEFRecompressFile(const FString& InFile, const FString& OutFile, const FUEFWriteOptions& Options);
@@ -35,6 +35,9 @@ public class UEFormat : ModuleRules
 			}
 		);
 
+		// Lets the writers compress on several threads through ZSTD_c_nbWorkers
+		PrivateDefinitions.Add("ZSTD_MULTITHREAD=1");
+
 		PrivateDependencyModuleNames.AddRange(
 			new string[]
 			{
@@ -42,7 +45,8 @@ public class UEFormat : ModuleRules
 				"SlateCore",
 				"EditorWidgets",
 				"MainFrame",
-				"ToolWidgets"
+				"ToolWidgets",
+				"Projects"
 			}
 		);
 	}
@@ -0,0 +1,330 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+// Throughput of the reader stages on the sample files, per file:
+//
+//   HeaderParse/<File>              opening the file and parsing the UEFormat header, per header byte
+//   Decompress/<Codec>/<File>       header plus decompressing the payload, per uncompressed byte
+//   ChunkParse/<Mode>/<File>        a full read of an uncompressed copy, i.e. header plus chunk parsing, per payload byte
+//   KeyExpansion/<Interp>/<File>    resampling every track of a read animation to one key per frame, per output byte
+//   KeyReduction/<Interp>/<Type>    reducing one static 3000 key track, the worst case for a greedy reducer, per key
+//
+// Samples are every .ueanim and .uemodel under UEFORMAT_BENCHMARK_DIR, by default Content/Character/Role of the
+// project. The ZSTD and GZIP copies the decompression benchmarks need are written to a temporary directory on start.
+
+#include <benchmark/benchmark.h>
+#include <unistd.h>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include "CoreMinimal.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Readers/UEFAnimReader.h"
+#include "Readers/UEFFileSource.h"
+#include "Readers/UEFModelReader.h"
+#include "UEFKeyResampler.h"
+#include "UEFormat.h"
+#include "zstd.h"
+
+#if UEFORMAT_STANDALONE_WITH_ZLIB
+	#include <zlib.h>
+#endif
+
+namespace
+{
+	constexpr int32 ZstdLevel = 3;
+
+	struct FSample
+	{
+		FString Name;
+		bool bAnim = false;
+		FUEFormatHeader Header;
+		int64 HeaderSize = 0;
+		int64 PayloadSize = 0;
+		FString UncompressedFile;
+		FString ZstdFile;
+		FString GzipFile;
+	};
+
+	void AppendFString(TArray<uint8>& Out, const std::string& String)
+	{
+		const int32 Len = static_cast<int32>(String.size());
+		Out.Append(reinterpret_cast<const uint8*>(&Len), sizeof(Len));
+		Out.Append(reinterpret_cast<const uint8*>(String.data()), Len);
+	}
+
+	// Header as the exporter writes it, CompressionType empty for an uncompressed file
+	TArray<uint8> WriteHeader(const FUEFormatHeader& Header, const std::string& CompressionType, int32 UncompressedSize, int32 CompressedSize)
+	{
+		TArray<uint8> Out;
+		Out.Append(reinterpret_cast<const uint8*>("UEFORMAT"), 8);
+		AppendFString(Out, Header.Identifier);
+		Out.Add(static_cast<uint8>(Header.FileVersionBytes));
+		AppendFString(Out, Header.ObjectName);
+		Out.Add(CompressionType.empty() ? 0 : 1);
+		if (!CompressionType.empty())
+		{
+			AppendFString(Out, CompressionType);
+			Out.Append(reinterpret_cast<const uint8*>(&UncompressedSize), sizeof(int32));
+			Out.Append(reinterpret_cast<const uint8*>(&CompressedSize), sizeof(int32));
+		}
+		return Out;
+	}
+
+	bool WriteCopy(const FString& Path, const FUEFormatHeader& Header, const std::string& CompressionType, int32 UncompressedSize, TConstArrayView<uint8> Data)
+	{
+		TArray<uint8> Out = WriteHeader(Header, CompressionType, UncompressedSize, Data.Num());
+		Out.Append(Data.GetData(), Data.Num());
+		return FFileHelper::SaveArrayToFile(Out, *Path);
+	}
+
+	bool Compress(const std::string& CompressionType, const char* Payload, int32 PayloadSize, TArray<uint8>& Out)
+	{
+		if (CompressionType == "ZSTD")
+		{
+			Out.SetNumUninitialized(static_cast<int32>(ZSTD_compressBound(PayloadSize)));
+			const size_t Size = ZSTD_compress(Out.GetData(), Out.Num(), Payload, PayloadSize, ZstdLevel);
+			if (ZSTD_isError(Size))
+				return false;
+			Out.SetNumUninitialized(static_cast<int32>(Size));
+			return true;
+		}
+#if UEFORMAT_STANDALONE_WITH_ZLIB
+		if (CompressionType == "GZIP")
+		{
+			z_stream Stream = {};
+			// 16 selects the gzip wrapper
+			if (deflateInit2(&Stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+				return false;
+			Out.SetNumUninitialized(static_cast<int32>(deflateBound(&Stream, PayloadSize)));
+			Stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(Payload));
+			Stream.avail_in = PayloadSize;
+			Stream.next_out = Out.GetData();
+			Stream.avail_out = Out.Num();
+			const int Result = deflate(&Stream, Z_FINISH);
+			deflateEnd(&Stream);
+			if (Result != Z_STREAM_END)
+				return false;
+			Out.SetNumUninitialized(static_cast<int32>(Stream.total_out));
+			return true;
+		}
+#endif
+		return false;
+	}
+
+	// Reads the header and payload of File and writes the copies the benchmarks run on into TempDir
+	bool PrepareSample(const FString& File, const FString& Directory, const FString& TempDir, int32 Index, FSample& Sample)
+	{
+		// Named by the path below the sample directory, file names alone repeat
+		Sample.Name = File;
+		FPaths::MakePathRelativeTo(Sample.Name, *(Directory + TEXT("/")));
+		Sample.bAnim = FPaths::GetExtension(File) == TEXT("ueanim");
+
+		FUEFFileSource Source(File, EUEFSourceMode::Stream);
+		if (Source.ReadHeader("UEFORMAT", Sample.Header).HasError() || Source.ReadPayload(Sample.Header, false).HasError())
+			return false;
+		const char* Payload = Source.GetPayload();
+		const int32 PayloadSize = Source.GetPayloadSize();
+		Sample.PayloadSize = PayloadSize;
+		Sample.HeaderSize = WriteHeader(Sample.Header, std::string(), 0, 0).Num();
+
+		const FString Base = FPaths::Combine(TempDir, FString::Printf(TEXT("%d_%s"), Index, *FPaths::GetCleanFilename(File)));
+		Sample.UncompressedFile = Base + TEXT(".raw");
+		if (!WriteCopy(Sample.UncompressedFile, Sample.Header, std::string(), PayloadSize, TConstArrayView<uint8>(reinterpret_cast<const uint8*>(Payload), PayloadSize)))
+			return false;
+
+		TArray<uint8> Compressed;
+		if (Compress("ZSTD", Payload, PayloadSize, Compressed))
+		{
+			Sample.ZstdFile = Base + TEXT(".zstd");
+			WriteCopy(Sample.ZstdFile, Sample.Header, "ZSTD", PayloadSize, Compressed);
+		}
+		if (Compress("GZIP", Payload, PayloadSize, Compressed))
+		{
+			Sample.GzipFile = Base + TEXT(".gzip");
+			WriteCopy(Sample.GzipFile, Sample.Header, "GZIP", PayloadSize, Compressed);
+		}
+		return true;
+	}
+
+	void BM_HeaderParse(benchmark::State& State, FString File, int64 HeaderSize)
+	{
+		for (auto _ : State)
+		{
+			FUEFFileSource Source(File, EUEFSourceMode::MemoryMapped);
+			FUEFormatHeader Header;
+			if (Source.ReadHeader("UEFORMAT", Header).HasError())
+			{
+				State.SkipWithError("ReadHeader failed");
+				return;
+			}
+			benchmark::DoNotOptimize(Header.UncompressedSize);
+		}
+		State.SetBytesProcessed(State.iterations() * HeaderSize);
+	}
+
+	void BM_Decompress(benchmark::State& State, FString File, int64 PayloadSize)
+	{
+		for (auto _ : State)
+		{
+			FUEFFileSource Source(File, EUEFSourceMode::MemoryMapped);
+			FUEFormatHeader Header;
+			if (Source.ReadHeader("UEFORMAT", Header).HasError() || Source.ReadPayload(Header, false).HasError())
+			{
+				State.SkipWithError("ReadPayload failed");
+				return;
+			}
+			benchmark::DoNotOptimize(Source.GetPayload());
+		}
+		State.SetBytesProcessed(State.iterations() * PayloadSize);
+	}
+
+	template<typename ReaderType>
+	void BM_ChunkParse(benchmark::State& State, FString File, EUEFSourceMode Mode, int64 PayloadSize)
+	{
+		for (auto _ : State)
+		{
+			ReaderType Reader(File, Mode);
+			if (Reader.Read().HasError())
+			{
+				State.SkipWithError("Read failed");
+				return;
+			}
+			benchmark::DoNotOptimize(Reader.Names.Num());
+		}
+		State.SetBytesProcessed(State.iterations() * PayloadSize);
+	}
+
+	void BM_KeyExpansion(benchmark::State& State, FString File, EUEFAnimInterpolation Interpolation)
+	{
+		UEFAnimReader Reader(File, EUEFSourceMode::MemoryMapped);
+		if (Reader.Read().HasError())
+		{
+			State.SkipWithError("Read failed");
+			return;
+		}
+
+		TArray<FVector3f> PosKeys;
+		TArray<FQuat4f> RotKeys;
+		TArray<FVector3f> ScaleKeys;
+		for (auto _ : State)
+		{
+			for (const FTrack& Track : Reader.Tracks)
+			{
+				UEFResampleKeys(Track.PosKeys, Reader.NumFrames, Interpolation, FVector3f::ZeroVector, PosKeys);
+				UEFResampleKeys(Track.RotKeys, Reader.NumFrames, Interpolation, FQuat4f::Identity, RotKeys);
+				UEFResampleKeys(Track.ScaleKeys, Reader.NumFrames, Interpolation, FVector3f::OneVector, ScaleKeys);
+				benchmark::DoNotOptimize(PosKeys.GetData());
+				benchmark::DoNotOptimize(RotKeys.GetData());
+				benchmark::DoNotOptimize(ScaleKeys.GetData());
+			}
+			benchmark::ClobberMemory();
+		}
+		const int64 BytesPerFrame = sizeof(FVector3f) + sizeof(FQuat4f) + sizeof(FVector3f);
+		State.SetBytesProcessed(State.iterations() * Reader.Tracks.Num() * Reader.NumFrames * BytesPerFrame);
+	}
+
+	// The track is copied back every iteration since reducing compacts it in place, the copy is part of the timing
+	template<typename T>
+	void BM_KeyReduction(benchmark::State& State, EUEFAnimInterpolation Interpolation, T Value, float Tolerance)
+	{
+		constexpr int32 NumKeys = 3000;
+		TArray<int32> SourceFrames;
+		TArray<T> SourceValues;
+		for (int32 Frame = 0; Frame < NumKeys; Frame++)
+		{
+			SourceFrames.Add(Frame);
+			SourceValues.Add(Value);
+		}
+
+		TArray<int32> Frames;
+		TArray<T> Values;
+		int32 NumKept = 0;
+		for (auto _ : State)
+		{
+			Frames = SourceFrames;
+			Values = SourceValues;
+			TUEFKeyStream<T> Keys{ MakeArrayView(Frames), MakeArrayView(Values) };
+			UEFReduceKeys(Keys, Interpolation, Tolerance);
+			NumKept = Keys.Num();
+			benchmark::DoNotOptimize(NumKept);
+		}
+		State.counters["KeptKeys"] = NumKept;
+		State.SetItemsProcessed(State.iterations() * NumKeys);
+	}
+
+	void RegisterKeyReduction()
+	{
+		for (const EUEFAnimInterpolation Interpolation : { EUEFAnimInterpolation::Step, EUEFAnimInterpolation::Linear })
+		{
+			const std::string Interp = Interpolation == EUEFAnimInterpolation::Step ? "Step" : "Linear";
+			benchmark::RegisterBenchmark(("KeyReduction/" + Interp + "/Position").c_str(), BM_KeyReduction<FVector3f>, Interpolation, FVector3f(1.0f, 2.0f, 3.0f), 0.001f);
+			benchmark::RegisterBenchmark(("KeyReduction/" + Interp + "/Rotation").c_str(), BM_KeyReduction<FQuat4f>, Interpolation, FQuat4f(0.0f, 0.0f, 0.38268343f, 0.92387953f), 0.001f);
+		}
+	}
+
+	void RegisterSample(const FSample& Sample)
+	{
+		const std::string Name = *Sample.Name;
+		benchmark::RegisterBenchmark(("HeaderParse/" + Name).c_str(), BM_HeaderParse, Sample.UncompressedFile, Sample.HeaderSize);
+		if (!Sample.ZstdFile.IsEmpty())
+			benchmark::RegisterBenchmark(("Decompress/ZSTD/" + Name).c_str(), BM_Decompress, Sample.ZstdFile, Sample.PayloadSize);
+		if (!Sample.GzipFile.IsEmpty())
+			benchmark::RegisterBenchmark(("Decompress/GZIP/" + Name).c_str(), BM_Decompress, Sample.GzipFile, Sample.PayloadSize);
+
+		const auto ChunkParse = Sample.bAnim ? BM_ChunkParse<UEFAnimReader> : BM_ChunkParse<UEFModelReader>;
+		benchmark::RegisterBenchmark(("ChunkParse/Mapped/" + Name).c_str(), ChunkParse, Sample.UncompressedFile, EUEFSourceMode::MemoryMapped, Sample.PayloadSize);
+		benchmark::RegisterBenchmark(("ChunkParse/Stream/" + Name).c_str(), ChunkParse, Sample.UncompressedFile, EUEFSourceMode::Stream, Sample.PayloadSize);
+
+		if (Sample.bAnim)
+		{
+			benchmark::RegisterBenchmark(("KeyExpansion/Step/" + Name).c_str(), BM_KeyExpansion, Sample.UncompressedFile, EUEFAnimInterpolation::Step);
+			benchmark::RegisterBenchmark(("KeyExpansion/Linear/" + Name).c_str(), BM_KeyExpansion, Sample.UncompressedFile, EUEFAnimInterpolation::Linear);
+		}
+	}
+}
+
+int main(int ArgC, char** ArgV)
+{
+	benchmark::Initialize(&ArgC, ArgV);
+	if (benchmark::ReportUnrecognizedArguments(ArgC, ArgV))
+		return 1;
+
+	FUEFormatModule Module;
+	Module.StartupModule();
+
+	const char* SampleDir = std::getenv("UEFORMAT_BENCHMARK_DIR");
+	const FString Directory(SampleDir ? SampleDir : UEFORMAT_SAMPLE_DIR);
+	TArray<FString> Files;
+	IFileManager::Get().FindFilesRecursive(Files, *Directory, TEXT("*.ueanim"), true, false);
+	IFileManager::Get().FindFilesRecursive(Files, *Directory, TEXT("*.uemodel"), true, false, false);
+	if (Files.IsEmpty())
+	{
+		std::fprintf(stderr, "No .ueanim or .uemodel files under %s\n", *Directory);
+		return 1;
+	}
+
+	const FString TempDir = FPaths::Combine(FString(std::filesystem::temp_directory_path().string()), FString::Printf(TEXT("UEFormatBenchmarks-%d"), static_cast<int32>(getpid())));
+	int32 NumFailed = 0;
+	for (int32 Index = 0; Index < Files.Num(); Index++)
+	{
+		FSample Sample;
+		if (PrepareSample(Files[Index], Directory, TempDir, Index, Sample))
+			RegisterSample(Sample);
+		else
+		{
+			std::fprintf(stderr, "Could not read %s\n", *Files[Index]);
+			NumFailed++;
+		}
+	}
+
+	RegisterKeyReduction();
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+
+	IFileManager::Get().DeleteDirectory(*TempDir, false, true);
+	Module.ShutdownModule();
+	return NumFailed > 0 ? 1 : 0;
+}
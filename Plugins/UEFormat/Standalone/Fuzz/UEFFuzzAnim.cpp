@@ -0,0 +1,51 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+// Fuzz target for UEFAnimReader: parses the input as a .ueanim through both source modes and expands the keys it
+// produced. Built for libFuzzer with UEFORMAT_STANDALONE_FUZZERS, otherwise driven by UEFFuzzReplay.cpp.
+
+#include "Readers/UEFAnimReader.h"
+#include "UEFFuzzInput.h"
+#include "UEFKeyResampler.h"
+
+namespace
+{
+	// Caps the frames expanded per track, NumFrames comes from the input
+	constexpr int32 MaxExpandedFrames = 1024;
+
+	void ReadAnim(const FString& Path, EUEFSourceMode Mode)
+	{
+		UEFAnimReader Reader(Path, Mode);
+		if (Reader.Read().HasError())
+			return;
+
+		const int32 NumFrames = FMath::Clamp(Reader.NumFrames, 0, MaxExpandedFrames);
+		TArray<FVector3f> Vectors;
+		TArray<FQuat4f> Quats;
+		for (FTrack& Track : Reader.Tracks)
+		{
+			UEFResampleKeys(Track.PosKeys, NumFrames, EUEFAnimInterpolation::Linear, FVector3f::ZeroVector, Vectors);
+			UEFResampleKeys(Track.RotKeys, NumFrames, EUEFAnimInterpolation::Step, FQuat4f::Identity, Quats);
+			UEFReduceKeys(Track.ScaleKeys, EUEFAnimInterpolation::Linear, 0.001f);
+			UEFResampleKeys(Track.ScaleKeys, NumFrames, EUEFAnimInterpolation::Linear, FVector3f::OneVector, Vectors);
+		}
+		for (const FCurve& Curve : Reader.Curves)
+			Reader.Names.Get(Curve.CurveName);
+	}
+}
+
+extern "C" int LLVMFuzzerInitialize(int*, char***)
+{
+	UEFConfigureFuzzing();
+	return 0;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8* Data, SIZE_T Size)
+{
+	static FUEFFuzzInput Input;
+	if (!Input.Write(Data, Size))
+		return 0;
+
+	ReadAnim(Input.GetPath(), EUEFSourceMode::MemoryMapped);
+	ReadAnim(Input.GetPath(), EUEFSourceMode::Stream);
+	return 0;
+}
@@ -0,0 +1,60 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cstdio>
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+#include "UEFormat.h"
+
+// The readers take a file name, so every input is written to an in-memory file and read back through its path.
+// That keeps the header, mapping and streaming code inside the fuzzed surface.
+class FUEFFuzzInput
+{
+public:
+	FUEFFuzzInput()
+	{
+		File = memfd_create("UEFormatFuzz", MFD_CLOEXEC);
+		if (File >= 0)
+			Path = FString::Printf(TEXT("/proc/self/fd/%d"), File);
+	}
+
+	~FUEFFuzzInput() { //Destructor
+		if (File >= 0)
+			close(File);
+	}
+
+	// Replaces the file's contents, false if it could not be written
+	bool Write(const uint8* Data, SIZE_T Size)
+	{
+		if (File < 0 || ftruncate(File, 0) != 0)
+			return false;
+		for (SIZE_T Written = 0; Written < Size;)
+		{
+			const ssize_t Result = pwrite(File, Data + Written, Size - Written, static_cast<off_t>(Written));
+			if (Result <= 0)
+				return false;
+			Written += static_cast<SIZE_T>(Result);
+		}
+		return true;
+	}
+
+	const FString& GetPath() const { return Path; }
+
+private:
+	int File = -1;
+	FString Path;
+};
+
+// Loads the module for the lifetime of the process and applies the settings shared by the fuzz targets: ZSTD payloads from 1 MB on are streamed, so a corrupt size cannot make the
+// reader allocate gigabytes up front, and decoding stays on the calling thread to keep runs reproducible.
+inline void UEFConfigureFuzzing()
+{
+	static FUEFormatModule Module;
+	Module.StartupModule();
+	if (IConsoleVariable* StreamingThreshold = IConsoleManager::Get().FindConsoleVariable(TEXT("UEFormat.Import.StreamingThresholdMB")))
+		StreamingThreshold->Set(TEXT("1"));
+	if (IConsoleVariable* ParallelThreshold = IConsoleManager::Get().FindConsoleVariable(TEXT("UEFormat.Import.ParallelDecodeThresholdKB")))
+		ParallelThreshold->Set(TEXT("0"));
+}
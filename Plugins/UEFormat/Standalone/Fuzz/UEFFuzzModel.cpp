@@ -0,0 +1,35 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+// Fuzz target for UEFModelReader: parses the input as a .uemodel with a full read and again through the table of
+// contents, LOD by LOD. Built for libFuzzer with UEFORMAT_STANDALONE_FUZZERS, otherwise driven by UEFFuzzReplay.cpp.
+
+#include "Readers/UEFModelReader.h"
+#include "UEFFuzzInput.h"
+
+extern "C" int LLVMFuzzerInitialize(int*, char***)
+{
+	UEFConfigureFuzzing();
+	return 0;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8* Data, SIZE_T Size)
+{
+	static FUEFFuzzInput Input;
+	if (!Input.Write(Data, Size))
+		return 0;
+
+	{
+		UEFModelReader Reader(Input.GetPath(), EUEFSourceMode::MemoryMapped);
+		Reader.Read();
+	}
+
+	UEFModelReader Reader(Input.GetPath(), EUEFSourceMode::Stream);
+	if (Reader.Open().HasError())
+		return 0;
+	Reader.ReadSkeletonOnly();
+	for (int32 LODIndex = Reader.LODs.Num() - 1; LODIndex >= 0; LODIndex--)
+		Reader.ReadLOD(LODIndex);
+	for (const FUEFChunkEntry& Entry : Reader.GetTableOfContents())
+		Reader.ReadChunk(Entry.Name, Entry.LODIndex);
+	return 0;
+}
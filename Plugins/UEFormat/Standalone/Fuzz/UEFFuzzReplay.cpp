@@ -0,0 +1,132 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+// Driver for the fuzz targets where libFuzzer is not available: runs every input as given, truncated at a spread of
+// lengths and with a fixed number of deterministic mutations, so each run covers exactly the same cases. Without
+// -mutations it also works as an AFL harness (afl-fuzz ... -- UEFormatFuzzAnim @@).
+//
+// Usage: UEFormatFuzzAnim|UEFormatFuzzModel [-mutations=<N>] [-seed=<N>] <File or directory>...
+// Returns non-zero if an input could not be read or none was given, a parser fault aborts the process.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "CoreMinimal.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+extern "C" int LLVMFuzzerInitialize(int* ArgC, char*** ArgV);
+extern "C" int LLVMFuzzerTestOneInput(const uint8* Data, SIZE_T Size);
+
+namespace
+{
+	// xorshift64*, the same sequence on every platform
+	struct FMutationRandom
+	{
+		uint64 State;
+
+		uint64 Next()
+		{
+			State ^= State >> 12;
+			State ^= State << 25;
+			State ^= State >> 27;
+			return State * 0x2545F4914F6CDD1DULL;
+		}
+		int32 Below(int32 Max) { return Max > 0 ? static_cast<int32>(Next() % static_cast<uint64>(Max)) : 0; }
+	};
+
+	// Sizes and counts that tend to sit on boundaries of the length checks
+	constexpr int32 InterestingValues[] = { 0, 1, -1, 2, 4, 8, 16, 255, 256, 4096, 65535, 65536, 0x7FFFFFFF, INT32_MIN, 0x3FFFFFFF, 0x10000000 };
+
+	void Mutate(TArray<uint8>& Data, FMutationRandom& Random)
+	{
+		const int32 Edits = 1 + Random.Below(4);
+		for (int32 Edit = 0; Edit < Edits; Edit++)
+		{
+			const int32 Offset = Random.Below(Data.Num());
+			switch (Random.Below(5))
+			{
+			case 0: // flip a bit
+				if (!Data.IsEmpty())
+					Data[Offset] ^= static_cast<uint8>(1 << Random.Below(8));
+				break;
+			case 1: // random byte
+				if (!Data.IsEmpty())
+					Data[Offset] = static_cast<uint8>(Random.Next());
+				break;
+			case 2: // length or count field
+				if (Data.Num() >= 4)
+				{
+					const int32 Value = InterestingValues[Random.Below(UE_ARRAY_COUNT(InterestingValues))];
+					FMemory::Memcpy(&Data[FMath::Min(Offset, Data.Num() - 4)], &Value, sizeof(Value));
+				}
+				break;
+			case 3: // insert bytes
+				Data.Insert(static_cast<uint8>(Random.Next()), Offset);
+				break;
+			default: // remove a run of bytes
+				if (!Data.IsEmpty())
+					Data.RemoveAt(Offset, FMath::Min(1 + Random.Below(16), Data.Num() - Offset));
+				break;
+			}
+		}
+	}
+
+	void Run(const TArray<uint8>& Input, int32 NumMutations, uint64 Seed)
+	{
+		LLVMFuzzerTestOneInput(Input.GetData(), Input.Num());
+
+		// Every length up to 256 bytes, then 64 lengths spread over the rest
+		const int32 Step = FMath::Max(1, (Input.Num() - 256) / 64);
+		for (int32 Length = 0; Length < Input.Num(); Length += Length < 256 ? 1 : Step)
+			LLVMFuzzerTestOneInput(Input.GetData(), Length);
+
+		FMutationRandom Random{ Seed | 1 };
+		TArray<uint8> Mutated;
+		for (int32 Mutation = 0; Mutation < NumMutations; Mutation++)
+		{
+			Mutated = Input;
+			Mutate(Mutated, Random);
+			LLVMFuzzerTestOneInput(Mutated.GetData(), Mutated.Num());
+		}
+	}
+}
+
+int main(int ArgC, char* ArgV[])
+{
+	LLVMFuzzerInitialize(&ArgC, &ArgV);
+
+	int32 NumMutations = 0;
+	uint64 Seed = 0x5EED;
+	TArray<FString> Inputs;
+	for (int32 Arg = 1; Arg < ArgC; Arg++)
+	{
+		if (std::strncmp(ArgV[Arg], "-mutations=", 11) == 0)
+			NumMutations = FMath::Max(0, std::atoi(ArgV[Arg] + 11));
+		else if (std::strncmp(ArgV[Arg], "-seed=", 6) == 0)
+			Seed = std::strtoull(ArgV[Arg] + 6, nullptr, 0);
+		else if (FPaths::DirectoryExists(ArgV[Arg]))
+		{
+			TArray<FString> Files;
+			IFileManager::Get().FindFilesRecursive(Files, ArgV[Arg], TEXT("*"), true, false);
+			Inputs.Append(Files);
+		}
+		else
+			Inputs.Add(ArgV[Arg]);
+	}
+
+	int32 Failed = 0;
+	for (const FString& Input : Inputs)
+	{
+		TArray<uint8> Data;
+		if (!FFileHelper::LoadFileToArray(Data, *Input))
+		{
+			std::fprintf(stderr, "%s: could not be read\n", ToCStr(Input));
+			Failed++;
+			continue;
+		}
+		Run(Data, NumMutations, Seed);
+		std::printf("%s: %d bytes, %d mutations\n", ToCStr(Input), Data.Num(), NumMutations);
+	}
+	return Inputs.IsEmpty() || Failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,24 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "HAL/Platform.h"
+
+// Engine animation enums stored in .ueanim files, values as in the engine
+
+enum EAdditiveAnimationType : int
+{
+	AAT_None,
+	AAT_LocalSpaceBase,
+	AAT_RotationOffsetMeshSpace,
+	AAT_MAX
+};
+
+enum EAdditiveBasePoseType : int
+{
+	ABPT_None,
+	ABPT_RefPose,
+	ABPT_AnimScaled,
+	ABPT_AnimFrame,
+	ABPT_LocalAnimFrame,
+	ABPT_MAX
+};
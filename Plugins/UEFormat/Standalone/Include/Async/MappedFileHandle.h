@@ -0,0 +1,39 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+enum class EMappedFileFlags : uint8
+{
+	ENone = 0,
+	EPreloadHint = 1,
+};
+
+class IMappedFileRegion
+{
+public:
+	IMappedFileRegion(const uint8* InMappedPtr, int64 InMappedSize) : MappedPtr(InMappedPtr), MappedSize(InMappedSize) {}
+	virtual ~IMappedFileRegion() = default;
+
+	const uint8* GetMappedPtr() const { return MappedPtr; }
+	int64 GetMappedSize() const { return MappedSize; }
+
+private:
+	const uint8* MappedPtr;
+	int64 MappedSize;
+};
+
+class IMappedFileHandle
+{
+public:
+	explicit IMappedFileHandle(int64 InFileSize) : FileSize(InFileSize) {}
+	virtual ~IMappedFileHandle() = default;
+
+	int64 GetFileSize() const { return FileSize; }
+
+	// Maps BytesToMap bytes from Offset, clamped to the file, null on failure. Regions must be released before the handle.
+	virtual IMappedFileRegion* MapRegion(int64 Offset = 0, int64 BytesToMap = INT64_MAX, EMappedFileFlags Flags = EMappedFileFlags::ENone) = 0;
+
+private:
+	int64 FileSize;
+};
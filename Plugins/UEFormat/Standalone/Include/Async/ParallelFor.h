@@ -0,0 +1,33 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+
+enum class EParallelForFlags
+{
+	None = 0,
+	ForceSingleThread = 1,
+	Unbalanced = 2,
+	PumpRenderingThread = 4,
+	BackgroundPriority = 8,
+};
+
+namespace UEFStandalone
+{
+	// Runs Body for every index on a process-wide pool of worker threads, the calling thread takes part. Safe to nest.
+	// The pool has one thread less than the machine has hardware threads, UEFORMAT_WORKER_THREADS overrides that.
+	UEFORMAT_API void ParallelForImpl(int32 Num, TFunctionRef<void(int32)> Body, bool bForceSingleThread);
+}
+
+template<typename BodyType>
+void ParallelFor(int32 Num, BodyType&& Body, bool bForceSingleThread = false)
+{
+	UEFStandalone::ParallelForImpl(Num, Body, bForceSingleThread);
+}
+
+template<typename BodyType>
+void ParallelFor(int32 Num, BodyType&& Body, EParallelForFlags Flags)
+{
+	UEFStandalone::ParallelForImpl(Num, Body, (static_cast<int32>(Flags) & static_cast<int32>(EParallelForFlags::ForceSingleThread)) != 0);
+}
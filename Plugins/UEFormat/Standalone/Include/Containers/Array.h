@@ -0,0 +1,165 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include <algorithm>
+#include <initializer_list>
+#include <memory>
+#include <vector>
+#include "HAL/UnrealMemory.h"
+#include "Templates/UnrealTemplate.h"
+
+enum class EAllowShrinking : uint8
+{
+	No,
+	Yes
+};
+
+struct FDefaultAllocator {};
+
+// Elements always live on the heap here, the inline storage is only a hint
+template<int32 NumInlineElements>
+struct TInlineAllocator {};
+
+// Default-initializes instead of value-initializing, so growing without a value leaves trivial elements
+// uninitialized like TArray::SetNumUninitialized does
+template<typename T>
+struct TDefaultInitAllocator : std::allocator<T>
+{
+	template<typename U> struct rebind { using other = TDefaultInitAllocator<U>; };
+
+	TDefaultInitAllocator() = default;
+	template<typename U> TDefaultInitAllocator(const TDefaultInitAllocator<U>&) {}
+
+	template<typename U> void construct(U* Ptr) { ::new (static_cast<void*>(Ptr)) U; }
+	template<typename U, typename... ArgTypes> void construct(U* Ptr, ArgTypes&&... Args) { ::new (static_cast<void*>(Ptr)) U(Forward<ArgTypes>(Args)...); }
+};
+
+template<typename InElementType, typename InAllocatorType = FDefaultAllocator>
+class TArray
+{
+public:
+	using ElementType = InElementType;
+	static_assert(!std::is_same_v<ElementType, bool>, "TArray<bool> is not supported by the standalone build");
+
+	TArray() = default;
+	TArray(std::initializer_list<ElementType> InitList) : Data(InitList.begin(), InitList.end()) {}
+	TArray(const ElementType* Ptr, int32 Count) : Data(Ptr, Ptr + Count) {}
+
+	int32 Num() const { return static_cast<int32>(Data.size()); }
+	int32 Max() const { return static_cast<int32>(Data.capacity()); }
+	bool IsEmpty() const { return Data.empty(); }
+	bool IsValidIndex(int32 Index) const { return Index >= 0 && Index < Num(); }
+	SIZE_T GetAllocatedSize() const { return Data.capacity() * sizeof(ElementType); }
+
+	ElementType* GetData() { return Data.data(); }
+	const ElementType* GetData() const { return Data.data(); }
+
+	ElementType& operator[](int32 Index) { check(IsValidIndex(Index)); return Data[Index]; }
+	const ElementType& operator[](int32 Index) const { check(IsValidIndex(Index)); return Data[Index]; }
+	ElementType& Last(int32 IndexFromTheEnd = 0) { return Data[Data.size() - 1 - IndexFromTheEnd]; }
+	const ElementType& Last(int32 IndexFromTheEnd = 0) const { return Data[Data.size() - 1 - IndexFromTheEnd]; }
+
+	ElementType* begin() { return Data.data(); }
+	ElementType* end() { return Data.data() + Data.size(); }
+	const ElementType* begin() const { return Data.data(); }
+	const ElementType* end() const { return Data.data() + Data.size(); }
+
+	int32 Add(const ElementType& Item) { Data.push_back(Item); return Num() - 1; }
+	int32 Add(ElementType&& Item) { Data.push_back(MoveTemp(Item)); return Num() - 1; }
+	ElementType& Add_GetRef(const ElementType& Item) { return Data.emplace_back(Item); }
+	ElementType& Add_GetRef(ElementType&& Item) { return Data.emplace_back(MoveTemp(Item)); }
+	void Push(const ElementType& Item) { Data.push_back(Item); }
+	void Push(ElementType&& Item) { Data.push_back(MoveTemp(Item)); }
+
+	template<typename... ArgTypes>
+	int32 Emplace(ArgTypes&&... Args) { Data.emplace_back(Forward<ArgTypes>(Args)...); return Num() - 1; }
+	template<typename... ArgTypes>
+	ElementType& Emplace_GetRef(ArgTypes&&... Args) { return Data.emplace_back(Forward<ArgTypes>(Args)...); }
+
+	int32 AddUninitialized(int32 Count = 1)
+	{
+		const int32 Index = Num();
+		Data.resize(Data.size() + Count);
+		return Index;
+	}
+	int32 AddZeroed(int32 Count = 1)
+	{
+		const int32 Index = AddUninitialized(Count);
+		FMemory::Memzero(Data.data() + Index, Count * sizeof(ElementType));
+		return Index;
+	}
+	int32 AddDefaulted(int32 Count = 1)
+	{
+		const int32 Index = Num();
+		Data.resize(Data.size() + Count, ElementType());
+		return Index;
+	}
+
+	void Append(const ElementType* Ptr, int32 Count) { Data.insert(Data.end(), Ptr, Ptr + Count); }
+	template<typename OtherAllocatorType>
+	void Append(const TArray<ElementType, OtherAllocatorType>& Other) { Append(Other.GetData(), Other.Num()); }
+
+	void Insert(const ElementType& Item, int32 Index) { Data.insert(Data.begin() + Index, Item); }
+	void RemoveAt(int32 Index, int32 Count = 1) { Data.erase(Data.begin() + Index, Data.begin() + Index + Count); }
+
+	ElementType Pop(EAllowShrinking AllowShrinking = EAllowShrinking::Yes)
+	{
+		ElementType Result = MoveTemp(Data.back());
+		Data.pop_back();
+		ShrinkIfAllowed(AllowShrinking);
+		return Result;
+	}
+
+	bool operator==(const TArray& Other) const { return Data == Other.Data; }
+	bool operator!=(const TArray& Other) const { return Data != Other.Data; }
+
+	bool Contains(const ElementType& Item) const { return std::find(Data.begin(), Data.end(), Item) != Data.end(); }
+	int32 Find(const ElementType& Item) const
+	{
+		const auto It = std::find(Data.begin(), Data.end(), Item);
+		return It != Data.end() ? static_cast<int32>(It - Data.begin()) : INDEX_NONE;
+	}
+
+	void SetNum(int32 NewNum, EAllowShrinking AllowShrinking = EAllowShrinking::Yes)
+	{
+		Data.resize(NewNum, ElementType());
+		ShrinkIfAllowed(AllowShrinking);
+	}
+	void SetNumUninitialized(int32 NewNum, EAllowShrinking AllowShrinking = EAllowShrinking::Yes)
+	{
+		Data.resize(NewNum);
+		ShrinkIfAllowed(AllowShrinking);
+	}
+	void SetNumZeroed(int32 NewNum, EAllowShrinking AllowShrinking = EAllowShrinking::Yes)
+	{
+		const int32 OldNum = Num();
+		SetNumUninitialized(NewNum, AllowShrinking);
+		if (NewNum > OldNum)
+			FMemory::Memzero(Data.data() + OldNum, (NewNum - OldNum) * sizeof(ElementType));
+	}
+
+	void Init(const ElementType& Element, int32 Number) { Data.assign(Number, Element); }
+	void Reserve(int32 Number) { Data.reserve(Number); }
+	void Reset(int32 NewSize = 0) { Data.clear(); Data.reserve(NewSize); }
+	void Empty(int32 Slack = 0)
+	{
+		std::vector<ElementType, TDefaultInitAllocator<ElementType>>().swap(Data);
+		Data.reserve(Slack);
+	}
+
+	template<typename PredicateType>
+	void Sort(PredicateType Predicate) { std::sort(Data.begin(), Data.end(), Predicate); }
+	void Sort() { std::sort(Data.begin(), Data.end()); }
+	template<typename PredicateType>
+	void StableSort(PredicateType Predicate) { std::stable_sort(Data.begin(), Data.end(), Predicate); }
+
+private:
+	std::vector<ElementType, TDefaultInitAllocator<ElementType>> Data;
+
+	// Like the engine's allocator policy, slack is only given back once it dominates the allocation
+	void ShrinkIfAllowed(EAllowShrinking AllowShrinking)
+	{
+		if (AllowShrinking == EAllowShrinking::Yes && Data.capacity() > 2 * Data.size() + 16)
+			Data.shrink_to_fit();
+	}
+};
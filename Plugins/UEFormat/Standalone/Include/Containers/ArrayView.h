@@ -0,0 +1,58 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include <type_traits>
+#include "Containers/Array.h"
+
+template<typename InElementType>
+class TArrayView
+{
+public:
+	using ElementType = InElementType;
+
+	TArrayView() = default;
+	TArrayView(ElementType* InData, int32 InNum) : DataPtr(InData), ArrayNum(InNum) {}
+
+	template<typename OtherElementType, typename = std::enable_if_t<std::is_convertible_v<OtherElementType(*)[], ElementType(*)[]>>>
+	TArrayView(const TArrayView<OtherElementType>& Other) : DataPtr(Other.GetData()), ArrayNum(Other.Num()) {}
+
+	template<typename OtherElementType, typename AllocatorType, typename = std::enable_if_t<std::is_convertible_v<OtherElementType(*)[], ElementType(*)[]>>>
+	TArrayView(TArray<OtherElementType, AllocatorType>& Other) : DataPtr(Other.GetData()), ArrayNum(Other.Num()) {}
+
+	template<typename OtherElementType, typename AllocatorType, typename = std::enable_if_t<std::is_convertible_v<const OtherElementType(*)[], ElementType(*)[]>>>
+	TArrayView(const TArray<OtherElementType, AllocatorType>& Other) : DataPtr(Other.GetData()), ArrayNum(Other.Num()) {}
+
+	ElementType* GetData() const { return DataPtr; }
+	int32 Num() const { return ArrayNum; }
+	bool IsEmpty() const { return ArrayNum == 0; }
+	bool IsValidIndex(int32 Index) const { return Index >= 0 && Index < ArrayNum; }
+
+	ElementType& operator[](int32 Index) const { check(IsValidIndex(Index)); return DataPtr[Index]; }
+	ElementType& Last() const { return DataPtr[ArrayNum - 1]; }
+
+	ElementType* begin() const { return DataPtr; }
+	ElementType* end() const { return DataPtr + ArrayNum; }
+
+	TArrayView Slice(int32 Index, int32 InNum) const
+	{
+		check(Index >= 0 && InNum >= 0 && Index + InNum <= ArrayNum);
+		return TArrayView(DataPtr + Index, InNum);
+	}
+	TArrayView Left(int32 Count) const { return TArrayView(DataPtr, Count < 0 ? 0 : Count < ArrayNum ? Count : ArrayNum); }
+
+private:
+	ElementType* DataPtr = nullptr;
+	int32 ArrayNum = 0;
+};
+
+template<typename ElementType>
+using TConstArrayView = TArrayView<const ElementType>;
+
+template<typename ElementType>
+TArrayView<ElementType> MakeArrayView(ElementType* Data, int32 Num) { return TArrayView<ElementType>(Data, Num); }
+
+template<typename ElementType, typename AllocatorType>
+TArrayView<ElementType> MakeArrayView(TArray<ElementType, AllocatorType>& Array) { return TArrayView<ElementType>(Array); }
+
+template<typename ElementType, typename AllocatorType>
+TArrayView<const ElementType> MakeArrayView(const TArray<ElementType, AllocatorType>& Array) { return TArrayView<const ElementType>(Array); }
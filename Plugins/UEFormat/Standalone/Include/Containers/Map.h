@@ -0,0 +1,72 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include <unordered_map>
+#include "Containers/Array.h"
+#include "Templates/TypeHash.h"
+
+template<typename KeyType, typename ValueType>
+struct TPair
+{
+	KeyType Key;
+	ValueType Value;
+};
+
+struct FDefaultSetAllocator {};
+
+template<typename KeyType, typename ValueType, bool bInAllowDuplicateKeys>
+struct TDefaultMapKeyFuncs
+{
+	static bool Matches(const KeyType& A, const KeyType& B) { return A == B; }
+	static uint32 GetKeyHash(const KeyType& Key) { return GetTypeHash(Key); }
+};
+
+// Pairs are stored in insertion order and indexed through a hash table driven by KeyFuncs.
+// Removal is not supported, which the readers never need.
+template<typename KeyType, typename ValueType, typename SetAllocator = FDefaultSetAllocator, typename KeyFuncs = TDefaultMapKeyFuncs<KeyType, ValueType, false>>
+class TMap
+{
+public:
+	using ElementType = TPair<KeyType, ValueType>;
+
+	int32 Num() const { return Pairs.Num(); }
+	bool IsEmpty() const { return Pairs.IsEmpty(); }
+
+	ValueType* Find(const KeyType& Key)
+	{
+		const auto It = Index.find(Key);
+		return It != Index.end() ? &Pairs[It->second].Value : nullptr;
+	}
+	const ValueType* Find(const KeyType& Key) const { return const_cast<TMap*>(this)->Find(Key); }
+	bool Contains(const KeyType& Key) const { return Index.find(Key) != Index.end(); }
+
+	ValueType& Add(const KeyType& Key, const ValueType& Value)
+	{
+		if (ValueType* Existing = Find(Key))
+			return *Existing = Value;
+		Index.emplace(Key, Pairs.Num());
+		return Pairs.Add_GetRef(ElementType{ Key, Value }).Value;
+	}
+	ValueType& FindOrAdd(const KeyType& Key)
+	{
+		if (ValueType* Existing = Find(Key))
+			return *Existing;
+		return Add(Key, ValueType());
+	}
+	ValueType& operator[](const KeyType& Key) { ValueType* Value = Find(Key); check(Value); return *Value; }
+
+	void Reserve(int32 Number) { Pairs.Reserve(Number); Index.reserve(Number); }
+	void Empty(int32 Slack = 0) { Pairs.Empty(Slack); Index.clear(); }
+
+	ElementType* begin() { return Pairs.begin(); }
+	ElementType* end() { return Pairs.end(); }
+	const ElementType* begin() const { return Pairs.begin(); }
+	const ElementType* end() const { return Pairs.end(); }
+
+private:
+	struct FHash { SIZE_T operator()(const KeyType& Key) const { return KeyFuncs::GetKeyHash(Key); } };
+	struct FEqual { bool operator()(const KeyType& A, const KeyType& B) const { return KeyFuncs::Matches(A, B); } };
+
+	TArray<ElementType> Pairs;
+	std::unordered_map<KeyType, int32, FHash, FEqual> Index;
+};
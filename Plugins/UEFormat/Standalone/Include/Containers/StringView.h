@@ -0,0 +1,53 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include <cstring>
+#include <string_view>
+#include "HAL/Platform.h"
+#include "Misc/CString.h"
+
+namespace ESearchCase
+{
+	enum Type
+	{
+		CaseSensitive,
+		IgnoreCase
+	};
+}
+
+template<typename CharType>
+class TStringView
+{
+public:
+	TStringView() = default;
+	TStringView(const CharType* InData, int32 InSize) : DataPtr(InData), Size(InSize) {}
+	TStringView(const CharType* InData) : DataPtr(InData), Size(InData ? static_cast<int32>(std::char_traits<CharType>::length(InData)) : 0) {}
+
+	const CharType* GetData() const { return DataPtr; }
+	int32 Len() const { return Size; }
+	bool IsEmpty() const { return Size == 0; }
+
+	const CharType& operator[](int32 Index) const { check(Index >= 0 && Index < Size); return DataPtr[Index]; }
+	const CharType* begin() const { return DataPtr; }
+	const CharType* end() const { return DataPtr + Size; }
+
+	bool Equals(TStringView Other, ESearchCase::Type SearchCase = ESearchCase::IgnoreCase) const
+	{
+		if (Size != Other.Size)
+			return false;
+		if (SearchCase == ESearchCase::CaseSensitive)
+			return Size == 0 || std::memcmp(DataPtr, Other.DataPtr, Size * sizeof(CharType)) == 0;
+		return FCString::Strnicmp(DataPtr, Other.DataPtr, Size) == 0;
+	}
+
+	// Like the engine, comparison operators ignore case
+	bool operator==(TStringView Other) const { return Equals(Other, ESearchCase::IgnoreCase); }
+	bool operator!=(TStringView Other) const { return !Equals(Other, ESearchCase::IgnoreCase); }
+
+private:
+	const CharType* DataPtr = nullptr;
+	int32 Size = 0;
+};
+
+using FStringView = TStringView<TCHAR>;
+using FAnsiStringView = TStringView<ANSICHAR>;
@@ -0,0 +1,113 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include <cstdarg>
+#include <cstdio>
+#include <string>
+#include "HAL/Platform.h"
+#include "Containers/StringView.h"
+#include "Misc/CString.h"
+
+// UTF-8 string with the FString interface the readers use
+class FString
+{
+public:
+	FString() = default;
+	FString(const TCHAR* InString) : Data(InString ? InString : "") {}
+	FString(const TCHAR* InString, int32 InLen) : Data(InString, InLen) {}
+	explicit FString(std::string InString) : Data(MoveTemp(InString)) {}
+	explicit FString(FStringView View) : Data(View.GetData(), View.Len()) {}
+
+	// Printf-style formatting. %s takes a TCHAR string and %hs an ANSI one, which are the same here.
+	static FString Printf(const TCHAR* Format, ...);
+
+	const TCHAR* operator*() const { return Data.c_str(); }
+	int32 Len() const { return static_cast<int32>(Data.size()); }
+	bool IsEmpty() const { return Data.empty(); }
+	TCHAR* GetCharArray() { return Data.data(); }
+
+	TCHAR* begin() { return Data.data(); }
+	TCHAR* end() { return Data.data() + Data.size(); }
+	const TCHAR* begin() const { return Data.data(); }
+	const TCHAR* end() const { return Data.data() + Data.size(); }
+
+	TCHAR& operator[](int32 Index) { return Data[Index]; }
+	const TCHAR& operator[](int32 Index) const { return Data[Index]; }
+
+	FString& operator+=(const FString& Other) { Data += Other.Data; return *this; }
+	FString& operator+=(const TCHAR* Other) { Data += Other; return *this; }
+	FString& operator+=(TCHAR Char) { Data += Char; return *this; }
+	FString operator+(const FString& Other) const { return FString(Data + Other.Data); }
+	FString operator+(const TCHAR* Other) const { return FString(Data + Other); }
+
+	// Joins two path components with a single separator
+	FString operator/(const FString& Other) const
+	{
+		if (Data.empty())
+			return Other;
+		FString Result = *this;
+		if (Result.Data.back() != '/' && (Other.Data.empty() || Other.Data.front() != '/'))
+			Result.Data += '/';
+		Result.Data += Other.Data;
+		return Result;
+	}
+
+	bool Equals(const FString& Other, ESearchCase::Type SearchCase = ESearchCase::CaseSensitive) const
+	{
+		return FStringView(**this, Len()).Equals(FStringView(*Other, Other.Len()), SearchCase);
+	}
+	// Like the engine, comparison operators ignore case
+	bool operator==(const FString& Other) const { return Equals(Other, ESearchCase::IgnoreCase); }
+	bool operator!=(const FString& Other) const { return !Equals(Other, ESearchCase::IgnoreCase); }
+
+	bool StartsWith(const FString& Prefix) const { return Data.compare(0, Prefix.Data.size(), Prefix.Data) == 0; }
+	bool EndsWith(const FString& Suffix) const
+	{
+		return Data.size() >= Suffix.Data.size() && Data.compare(Data.size() - Suffix.Data.size(), Suffix.Data.size(), Suffix.Data) == 0;
+	}
+	FString Mid(int32 Start, int32 Count = MAX_int32) const
+	{
+		return Start < Len() ? FString(Data.substr(Start, Count < 0 ? 0 : static_cast<SIZE_T>(Count))) : FString();
+	}
+	FString RightChop(int32 Count) const { return Mid(Count); }
+	void Empty() { Data.clear(); }
+
+	const std::string& ToStdString() const { return Data; }
+
+private:
+	std::string Data;
+};
+
+inline FString operator+(const TCHAR* A, const FString& B) { return FString(A) + B; }
+
+inline const TCHAR* ToCStr(const FString& String) { return *String; }
+
+inline FString FString::Printf(const TCHAR* Format, ...)
+{
+	// %hs has no meaning to vsnprintf for char strings, so it is rewritten to %s
+	std::string Fixed = Format;
+	for (SIZE_T Pos = 0; (Pos = Fixed.find('%', Pos)) != std::string::npos; Pos += 2)
+	{
+		if (Pos + 1 < Fixed.size() && Fixed[Pos + 1] == '%')
+			continue;
+		const SIZE_T Conversion = Fixed.find_first_of("diouxXeEfFgGaAcspn", Pos + 1);
+		if (Conversion != std::string::npos && Fixed[Conversion] == 's' && Fixed[Conversion - 1] == 'h')
+			Fixed.erase(Conversion - 1, 1);
+	}
+
+	va_list Args;
+	va_start(Args, Format);
+	va_list ArgsCopy;
+	va_copy(ArgsCopy, Args);
+	const int Needed = std::vsnprintf(nullptr, 0, Fixed.c_str(), Args);
+	va_end(Args);
+
+	FString Result;
+	if (Needed > 0)
+	{
+		Result.Data.resize(Needed);
+		std::vsnprintf(Result.Data.data(), Needed + 1, Fixed.c_str(), ArgsCopy);
+	}
+	va_end(ArgsCopy);
+	return Result;
+}
@@ -0,0 +1,24 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "HAL/Platform.h"
+#include "HAL/UnrealMemory.h"
+#include "Templates/UnrealTemplate.h"
+#include "Templates/UniquePtr.h"
+#include "Templates/SharedPointer.h"
+#include "Templates/TypeHash.h"
+#include "Math/UnrealMathUtility.h"
+#include "Math/Vector.h"
+#include "Math/Quat.h"
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Containers/Map.h"
+#include "Containers/StringView.h"
+#include "Containers/UnrealString.h"
+#include "Misc/CString.h"
+#include "Misc/Crc.h"
+#include "UObject/NameTypes.h"
+#include "Logging/LogMacros.h"
+
+// Inside the editor these come from Engine through the module's shared PCH
+#include "Animation/AnimTypes.h"
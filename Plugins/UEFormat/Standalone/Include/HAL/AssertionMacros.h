@@ -0,0 +1,10 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include <cassert>
+
+// Checks are compiled out with NDEBUG, as in shipping builds of the engine
+#define check(Expr) assert(Expr)
+#define checkf(Expr, Format, ...) assert(Expr)
+#define checkNoEntry() assert(false)
+#define ensure(Expr) (!!(Expr))
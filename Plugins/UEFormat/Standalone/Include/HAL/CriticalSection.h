@@ -0,0 +1,15 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include <mutex>
+
+class FCriticalSection
+{
+public:
+	void Lock() { Mutex.lock(); }
+	bool TryLock() { return Mutex.try_lock(); }
+	void Unlock() { Mutex.unlock(); }
+
+private:
+	std::recursive_mutex Mutex;
+};
@@ -0,0 +1,20 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+class UEFORMAT_API IFileManager
+{
+public:
+	static IFileManager& Get();
+
+	// Wildcard is a directory followed by a file pattern, which may use * and ?. Results are file names without the directory.
+	void FindFiles(TArray<FString>& FoundFiles, const TCHAR* Wildcard, bool bFiles, bool bDirectories);
+	// Results are full paths, sorted
+	void FindFilesRecursive(TArray<FString>& FoundFiles, const TCHAR* StartDirectory, const TCHAR* Wildcard, bool bFiles, bool bDirectories, bool bClearFileNames = true);
+
+	int64 FileSize(const TCHAR* Filename);
+	bool MakeDirectory(const TCHAR* Path, bool bTree = false);
+	bool Delete(const TCHAR* Filename);
+	bool DeleteDirectory(const TCHAR* Path, bool bRequireExists = false, bool bTree = false);
+};
@@ -0,0 +1,111 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include <atomic>
+#include <cstdlib>
+#include <type_traits>
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+
+enum EConsoleVariableFlags
+{
+	ECVF_Default = 0x0,
+	ECVF_ReadOnly = 0x4,
+};
+
+class IConsoleVariable
+{
+public:
+	virtual ~IConsoleVariable() = default;
+
+	virtual void Set(const TCHAR* Value) = 0;
+	virtual bool GetBool() const = 0;
+	virtual int32 GetInt() const = 0;
+	virtual float GetFloat() const = 0;
+};
+
+class UEFORMAT_API IConsoleManager
+{
+public:
+	static IConsoleManager& Get();
+
+	// Null if no variable of that name exists, names ignore case
+	IConsoleVariable* FindConsoleVariable(const TCHAR* Name) const;
+
+	void RegisterConsoleVariable(const TCHAR* Name, IConsoleVariable* Variable);
+	void UnregisterConsoleVariable(IConsoleVariable* Variable);
+
+private:
+	TArray<TPair<FString, IConsoleVariable*>> Variables;
+};
+
+// Console variable of type bool, int32 or float. There is no console outside the editor, so a variable starts out
+// with the value of the environment variable named after it with dots replaced by underscores
+// (UEFormat_Import_MemoryMapped for UEFormat.Import.MemoryMapped) and can be changed through IConsoleManager.
+template<typename T>
+class TAutoConsoleVariable : private IConsoleVariable
+{
+	static_assert(std::is_same_v<T, bool> || std::is_same_v<T, int32> || std::is_same_v<T, float>, "Unsupported console variable type");
+
+public:
+	TAutoConsoleVariable(const TCHAR* Name, const T& DefaultValue, const TCHAR* /*Help*/, uint32 /*Flags*/ = ECVF_Default)
+		: Value(DefaultValue)
+	{
+		FString EnvironmentName(Name);
+		for (TCHAR& Char : EnvironmentName)
+			Char = Char == '.' ? '_' : Char;
+		if (const char* EnvironmentValue = std::getenv(*EnvironmentName))
+			Set(EnvironmentValue);
+		IConsoleManager::Get().RegisterConsoleVariable(Name, this);
+	}
+
+	~TAutoConsoleVariable() override { IConsoleManager::Get().UnregisterConsoleVariable(this); }
+
+	T GetValueOnAnyThread() const { return Value.load(std::memory_order_relaxed); }
+	T GetValueOnGameThread() const { return GetValueOnAnyThread(); }
+
+	IConsoleVariable* AsVariable() { return this; }
+
+private:
+	std::atomic<T> Value;
+
+	void Set(const TCHAR* InValue) override
+	{
+		if constexpr (std::is_same_v<T, float>)
+			Value = FCString::Atof(InValue);
+		else if constexpr (std::is_same_v<T, bool>)
+			Value = FCString::Stricmp(InValue, TEXT("true")) == 0 || FCString::Atoi(InValue) != 0;
+		else
+			Value = FCString::Atoi(InValue);
+	}
+	bool GetBool() const override { return GetValueOnAnyThread() != T(0); }
+	int32 GetInt() const override { return static_cast<int32>(GetValueOnAnyThread()); }
+	float GetFloat() const override { return static_cast<float>(GetValueOnAnyThread()); }
+};
+
+struct FConsoleCommandDelegate
+{
+	TFunction<void()> Function;
+
+	template<typename FunctorType>
+	static FConsoleCommandDelegate CreateLambda(FunctorType&& Functor) { return { Forward<FunctorType>(Functor) }; }
+	void ExecuteIfBound() const { if (Function) Function(); }
+};
+
+struct FConsoleCommandWithArgsDelegate
+{
+	TFunction<void(const TArray<FString>&)> Function;
+
+	static FConsoleCommandWithArgsDelegate CreateStatic(void (*Callback)(const TArray<FString>&)) { return { Callback }; }
+	template<typename FunctorType>
+	static FConsoleCommandWithArgsDelegate CreateLambda(FunctorType&& Functor) { return { Forward<FunctorType>(Functor) }; }
+	void ExecuteIfBound(const TArray<FString>& Args) const { if (Function) Function(Args); }
+};
+
+// Kept so command registrations compile, nothing dispatches to them outside the editor
+class FAutoConsoleCommand
+{
+public:
+	FAutoConsoleCommand(const TCHAR* /*Name*/, const TCHAR* /*Help*/, const FConsoleCommandDelegate& /*Command*/, uint32 /*Flags*/ = ECVF_Default) {}
+	FAutoConsoleCommand(const TCHAR* /*Name*/, const TCHAR* /*Help*/, const FConsoleCommandWithArgsDelegate& /*Command*/, uint32 /*Flags*/ = ECVF_Default) {}
+};
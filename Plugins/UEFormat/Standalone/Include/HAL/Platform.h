@@ -0,0 +1,56 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+
+// Standalone stand-in for the part of UE's Core module the UEFormat readers use. Only what the readers need is
+// declared, with the same names and semantics, so the reader sources compile unchanged outside the engine.
+// TCHAR is char here: strings are UTF-8 and TEXT() is a no-op.
+
+#include <cstddef>
+#include <cstdint>
+
+typedef std::uint8_t uint8;
+typedef std::uint16_t uint16;
+typedef std::uint32_t uint32;
+typedef std::uint64_t uint64;
+typedef std::int8_t int8;
+typedef std::int16_t int16;
+typedef std::int32_t int32;
+typedef std::int64_t int64;
+typedef std::uintptr_t UPTRINT;
+typedef std::intptr_t PTRINT;
+typedef std::size_t SIZE_T;
+
+typedef char ANSICHAR;
+typedef char TCHAR;
+
+#define TEXT(x) x
+#define UTF8_TO_TCHAR(x) (x)
+#define TCHAR_TO_UTF8(x) (x)
+#define ANSI_TO_TCHAR(x) (x)
+
+#define FORCEINLINE inline __attribute__((always_inline))
+#define FORCENOINLINE __attribute__((noinline))
+#define UEFORMAT_API
+
+#define INDEX_NONE (-1)
+#define MAX_int32 (static_cast<int32>(0x7fffffff))
+#define MAX_uint32 (static_cast<uint32>(0xffffffff))
+#define UE_ARRAY_COUNT(Array) (sizeof(Array) / sizeof((Array)[0]))
+
+#define UE_SMALL_NUMBER (1.e-8f)
+#define UE_KINDA_SMALL_NUMBER (1.e-4f)
+
+#if defined(__x86_64__) || defined(__i386__)
+	#define PLATFORM_CPU_X86_FAMILY 1
+#else
+	#define PLATFORM_CPU_X86_FAMILY 0
+#endif
+#define PLATFORM_ENABLE_VECTORINTRINSICS PLATFORM_CPU_X86_FAMILY
+#if defined(__AVX2__)
+	#define PLATFORM_ALWAYS_HAS_AVX_2 1
+#else
+	#define PLATFORM_ALWAYS_HAS_AVX_2 0
+#endif
+
+#include "HAL/AssertionMacros.h"
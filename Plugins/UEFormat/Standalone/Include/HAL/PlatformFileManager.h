@@ -0,0 +1,32 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Async/MappedFileHandle.h"
+#include "Templates/ValueOrError.h"
+
+struct FFileSystemError
+{
+	FString Message;
+};
+
+using FOpenMappedResult = TValueOrError<TUniquePtr<IMappedFileHandle>, FFileSystemError>;
+
+class UEFORMAT_API IPlatformFile
+{
+public:
+	// Opens Filename for read-only memory mapping
+	FOpenMappedResult OpenMappedEx(const TCHAR* Filename);
+	bool FileExists(const TCHAR* Filename);
+	int64 FileSize(const TCHAR* Filename);
+};
+
+class UEFORMAT_API FPlatformFileManager
+{
+public:
+	static FPlatformFileManager& Get();
+	IPlatformFile& GetPlatformFile() { return PlatformFile; }
+
+private:
+	IPlatformFile PlatformFile;
+};
@@ -0,0 +1,25 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include <cstdlib>
+#include <cstring>
+#include "HAL/Platform.h"
+
+struct FMemory
+{
+	static constexpr SIZE_T DefaultAlignment = 16;
+
+	static void* Malloc(SIZE_T Size, uint32 Alignment = DefaultAlignment)
+	{
+		const SIZE_T Align = Alignment < sizeof(void*) ? sizeof(void*) : Alignment;
+		void* Result = nullptr;
+		return posix_memalign(&Result, Align, Size ? Size : 1) == 0 ? Result : nullptr;
+	}
+	static void Free(void* Ptr) { std::free(Ptr); }
+
+	static void* Memcpy(void* Dest, const void* Src, SIZE_T Count) { return std::memcpy(Dest, Src, Count); }
+	static void* Memmove(void* Dest, const void* Src, SIZE_T Count) { return std::memmove(Dest, Src, Count); }
+	static void* Memset(void* Dest, uint8 Value, SIZE_T Count) { return std::memset(Dest, Value, Count); }
+	static void* Memzero(void* Dest, SIZE_T Count) { return std::memset(Dest, 0, Count); }
+	static int32 Memcmp(const void* A, const void* B, SIZE_T Count) { return std::memcmp(A, B, Count); }
+};
@@ -0,0 +1,24 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+class IPlugin
+{
+public:
+	explicit IPlugin(FString InBaseDir) : BaseDir(MoveTemp(InBaseDir)) {}
+
+	const FString& GetBaseDir() const { return BaseDir; }
+
+private:
+	FString BaseDir;
+};
+
+// Knows the one plugin of the standalone build, found at the plugin directory it was configured from
+class UEFORMAT_API IPluginManager
+{
+public:
+	static IPluginManager& Get();
+
+	TSharedPtr<IPlugin> FindPlugin(const TCHAR* Name);
+};
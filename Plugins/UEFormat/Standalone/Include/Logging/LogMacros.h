@@ -0,0 +1,43 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "Containers/UnrealString.h"
+
+namespace ELogVerbosity
+{
+	enum Type : uint8
+	{
+		NoLogging,
+		Fatal,
+		Error,
+		Warning,
+		Display,
+		Log,
+		Verbose,
+		VeryVerbose
+	};
+}
+
+struct FLogCategoryBase
+{
+	const TCHAR* Name;
+};
+
+#define DECLARE_LOG_CATEGORY_EXTERN(CategoryName, DefaultVerbosity, CompileTimeVerbosity) extern FLogCategoryBase CategoryName;
+#define DEFINE_LOG_CATEGORY(CategoryName) FLogCategoryBase CategoryName{ TEXT(#CategoryName) };
+
+DECLARE_LOG_CATEGORY_EXTERN(LogTemp, Log, All);
+
+namespace UEFStandalone
+{
+	// Messages up to this verbosity are printed to stderr, Warning unless UEFORMAT_LOG_VERBOSITY names another level
+	UEFORMAT_API ELogVerbosity::Type GetLogVerbosity();
+	UEFORMAT_API void WriteLog(const FLogCategoryBase& Category, ELogVerbosity::Type Verbosity, const FString& Message);
+}
+
+#define UE_LOG(CategoryName, Verbosity, Format, ...) \
+	do \
+	{ \
+		if (ELogVerbosity::Verbosity <= UEFStandalone::GetLogVerbosity()) \
+			UEFStandalone::WriteLog(CategoryName, ELogVerbosity::Verbosity, FString::Printf(Format, ##__VA_ARGS__)); \
+	} while (false)
@@ -0,0 +1,67 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "Math/Vector.h"
+
+struct alignas(16) FQuat4f
+{
+	float X = 0.0f;
+	float Y = 0.0f;
+	float Z = 0.0f;
+	float W = 1.0f;
+
+	static const FQuat4f Identity;
+
+	FQuat4f() = default;
+	FQuat4f(float InX, float InY, float InZ, float InW) : X(InX), Y(InY), Z(InZ), W(InW) {}
+
+	bool operator==(const FQuat4f& Q) const { return X == Q.X && Y == Q.Y && Z == Q.Z && W == Q.W; }
+
+	float SizeSquared() const { return X * X + Y * Y + Z * Z + W * W; }
+
+	FQuat4f GetNormalized(float Tolerance = UE_SMALL_NUMBER) const
+	{
+		const float SquareSum = SizeSquared();
+		if (SquareSum < Tolerance)
+			return Identity;
+		const float Scale = FMath::InvSqrt(SquareSum);
+		return FQuat4f(X * Scale, Y * Scale, Z * Scale, W * Scale);
+	}
+
+	// Angle in radians of the rotation between this and Q
+	float AngularDistance(const FQuat4f& Q) const
+	{
+		const float InnerProd = X * Q.X + Y * Q.Y + Z * Q.Z + W * Q.W;
+		return FMath::Acos(2.0f * InnerProd * InnerProd - 1.0f);
+	}
+
+	// Shortest path spherical interpolation, the result is normalized
+	static FQuat4f Slerp(const FQuat4f& Quat1, const FQuat4f& Quat2, float Slerp)
+	{
+		const float RawCosom = Quat1.X * Quat2.X + Quat1.Y * Quat2.Y + Quat1.Z * Quat2.Z + Quat1.W * Quat2.W;
+		const float Cosom = RawCosom >= 0.0f ? RawCosom : -RawCosom;
+
+		float Scale0, Scale1;
+		if (Cosom < 0.9999f)
+		{
+			const float Omega = FMath::Acos(Cosom);
+			const float InvSin = 1.0f / FMath::Sin(Omega);
+			Scale0 = FMath::Sin((1.0f - Slerp) * Omega) * InvSin;
+			Scale1 = FMath::Sin(Slerp * Omega) * InvSin;
+		}
+		else
+		{
+			Scale0 = 1.0f - Slerp;
+			Scale1 = Slerp;
+		}
+		Scale1 = RawCosom >= 0.0f ? Scale1 : -Scale1;
+
+		return FQuat4f(
+			Scale0 * Quat1.X + Scale1 * Quat2.X,
+			Scale0 * Quat1.Y + Scale1 * Quat2.Y,
+			Scale0 * Quat1.Z + Scale1 * Quat2.Z,
+			Scale0 * Quat1.W + Scale1 * Quat2.W).GetNormalized();
+	}
+};
+
+inline const FQuat4f FQuat4f::Identity(0.0f, 0.0f, 0.0f, 1.0f);
@@ -0,0 +1,37 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include <cmath>
+#include <type_traits>
+#include "HAL/Platform.h"
+
+#define UE_PI (3.1415926535897932f)
+
+struct FMath
+{
+	template<typename T> static constexpr T Min(T A, T B) { return A < B ? A : B; }
+	template<typename T> static constexpr T Max(T A, T B) { return A > B ? A : B; }
+	template<typename T> static constexpr T Clamp(T X, T MinValue, T MaxValue) { return X < MinValue ? MinValue : X < MaxValue ? X : MaxValue; }
+	template<typename T> static constexpr T Abs(T A) { return A < T(0) ? -A : A; }
+	template<typename T> static constexpr T Square(T A) { return A * A; }
+	template<typename T> static constexpr bool IsPowerOfTwo(T Value) { return Value > 0 && (Value & (Value - 1)) == 0; }
+	template<typename T> static constexpr T DivideAndRoundUp(T Dividend, T Divisor) { return (Dividend + Divisor - 1) / Divisor; }
+
+	template<typename T, typename U>
+	static T Lerp(const T& A, const T& B, const U& Alpha) { return static_cast<T>(A + Alpha * (B - A)); }
+
+	static float Sqrt(float Value) { return std::sqrt(Value); }
+	static float InvSqrt(float Value) { return 1.0f / std::sqrt(Value); }
+	static float Acos(float Value) { return std::acos(Clamp(Value, -1.0f, 1.0f)); }
+	static float Asin(float Value) { return std::asin(Clamp(Value, -1.0f, 1.0f)); }
+	static float Sin(float Value) { return std::sin(Value); }
+	static float RadiansToDegrees(float Radians) { return Radians * (180.0f / UE_PI); }
+	static float DegreesToRadians(float Degrees) { return Degrees * (UE_PI / 180.0f); }
+};
+
+template<typename T>
+constexpr T Align(T Value, uint64 Alignment)
+{
+	static_assert(std::is_integral_v<T> || std::is_pointer_v<T>, "Align expects an integer or a pointer");
+	return (T)(((uint64)Value + Alignment - 1) & ~(Alignment - 1));
+}
@@ -0,0 +1,61 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "Math/UnrealMathUtility.h"
+
+struct FVector2f
+{
+	float X = 0.0f;
+	float Y = 0.0f;
+
+	FVector2f() = default;
+	FVector2f(float InX, float InY) : X(InX), Y(InY) {}
+};
+
+struct FVector3f
+{
+	float X = 0.0f;
+	float Y = 0.0f;
+	float Z = 0.0f;
+
+	static const FVector3f ZeroVector;
+	static const FVector3f OneVector;
+
+	FVector3f() = default;
+	FVector3f(float InX, float InY, float InZ) : X(InX), Y(InY), Z(InZ) {}
+
+	FVector3f operator+(const FVector3f& V) const { return FVector3f(X + V.X, Y + V.Y, Z + V.Z); }
+	FVector3f operator-(const FVector3f& V) const { return FVector3f(X - V.X, Y - V.Y, Z - V.Z); }
+	FVector3f operator*(float Scale) const { return FVector3f(X * Scale, Y * Scale, Z * Scale); }
+	bool operator==(const FVector3f& V) const { return X == V.X && Y == V.Y && Z == V.Z; }
+
+	float SizeSquared() const { return X * X + Y * Y + Z * Z; }
+	float Size() const { return FMath::Sqrt(SizeSquared()); }
+
+	static float DistSquared(const FVector3f& A, const FVector3f& B) { return (B - A).SizeSquared(); }
+	static float Dist(const FVector3f& A, const FVector3f& B) { return FMath::Sqrt(DistSquared(A, B)); }
+};
+
+inline const FVector3f FVector3f::ZeroVector(0.0f, 0.0f, 0.0f);
+inline const FVector3f FVector3f::OneVector(1.0f, 1.0f, 1.0f);
+
+inline FVector3f operator*(float Scale, const FVector3f& V) { return V * Scale; }
+
+struct alignas(16) FVector4f
+{
+	float X = 0.0f;
+	float Y = 0.0f;
+	float Z = 0.0f;
+	float W = 0.0f;
+
+	FVector4f() = default;
+	FVector4f(float InX, float InY, float InZ, float InW) : X(InX), Y(InY), Z(InZ), W(InW) {}
+};
+
+struct FColor
+{
+	uint8 B = 0;
+	uint8 G = 0;
+	uint8 R = 0;
+	uint8 A = 0;
+};
@@ -0,0 +1,19 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <strings.h>
+#include "HAL/Platform.h"
+
+struct FCString
+{
+	static int32 Strlen(const TCHAR* String) { return static_cast<int32>(std::strlen(String)); }
+	static int32 Strcmp(const TCHAR* A, const TCHAR* B) { return std::strcmp(A, B); }
+	static int32 Stricmp(const TCHAR* A, const TCHAR* B) { return strcasecmp(A, B); }
+	static int32 Strnicmp(const TCHAR* A, const TCHAR* B, SIZE_T Count) { return Count ? strncasecmp(A, B, Count) : 0; }
+	static int32 Atoi(const TCHAR* String) { return static_cast<int32>(std::strtol(String, nullptr, 10)); }
+	static int64 Atoi64(const TCHAR* String) { return std::strtoll(String, nullptr, 10); }
+	static float Atof(const TCHAR* String) { return std::strtof(String, nullptr); }
+};
@@ -0,0 +1,15 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+enum ECompressionFlags
+{
+	COMPRESS_NoFlags = 0,
+};
+
+struct UEFORMAT_API FCompression
+{
+	// Only NAME_Gzip is supported, and only when the standalone build found zlib
+	static bool UncompressMemory(FName FormatName, void* UncompressedBuffer, int64 UncompressedSize, const void* CompressedBuffer, int64 CompressedSize, ECompressionFlags Flags = COMPRESS_NoFlags, int32 CompressionData = 0);
+};
@@ -0,0 +1,32 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "HAL/Platform.h"
+
+struct FCrc
+{
+	// CRC-32 (polynomial 0x04C11DB7, reflected) of Length bytes
+	static uint32 MemCrc32(const void* Data, int32 Length, uint32 CRC = 0)
+	{
+		static const struct FTable
+		{
+			uint32 Entries[256];
+			FTable()
+			{
+				for (uint32 Index = 0; Index < 256; Index++)
+				{
+					uint32 Value = Index;
+					for (int32 Bit = 0; Bit < 8; Bit++)
+						Value = Value & 1 ? (Value >> 1) ^ 0xEDB88320u : Value >> 1;
+					Entries[Index] = Value;
+				}
+			}
+		} Table;
+
+		const uint8* Bytes = static_cast<const uint8*>(Data);
+		CRC = ~CRC;
+		for (int32 Index = 0; Index < Length; Index++)
+			CRC = (CRC >> 8) ^ Table.Entries[(CRC ^ Bytes[Index]) & 0xFF];
+		return ~CRC;
+	}
+};
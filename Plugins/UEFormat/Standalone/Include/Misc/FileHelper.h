@@ -0,0 +1,11 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+struct UEFORMAT_API FFileHelper
+{
+	static bool LoadFileToArray(TArray<uint8>& Result, const TCHAR* Filename, uint32 Flags = 0);
+	// Creates missing parent directories
+	static bool SaveArrayToFile(TArrayView<const uint8> Array, const TCHAR* Filename);
+};
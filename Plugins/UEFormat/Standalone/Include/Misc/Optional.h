@@ -0,0 +1,34 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include <optional>
+#include "HAL/Platform.h"
+#include "Templates/UnrealTemplate.h"
+
+template<typename T>
+class TOptional
+{
+public:
+	TOptional() = default;
+	TOptional(const T& InValue) : Value(InValue) {}
+	TOptional(T&& InValue) : Value(MoveTemp(InValue)) {}
+
+	bool IsSet() const { return Value.has_value(); }
+	explicit operator bool() const { return IsSet(); }
+
+	T& GetValue() { check(IsSet()); return *Value; }
+	const T& GetValue() const { check(IsSet()); return *Value; }
+	const T& Get(const T& DefaultValue) const { return IsSet() ? *Value : DefaultValue; }
+
+	T* operator->() { return &GetValue(); }
+	const T* operator->() const { return &GetValue(); }
+	T& operator*() { return GetValue(); }
+	const T& operator*() const { return GetValue(); }
+
+	template<typename... ArgTypes>
+	T& Emplace(ArgTypes&&... Args) { return Value.emplace(Forward<ArgTypes>(Args)...); }
+	void Reset() { Value.reset(); }
+
+private:
+	std::optional<T> Value;
+};
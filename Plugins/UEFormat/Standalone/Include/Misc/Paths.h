@@ -0,0 +1,26 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+class UEFORMAT_API FPaths
+{
+public:
+	template<typename... PathTypes>
+	static FString Combine(const FString& First, const PathTypes&... Rest)
+	{
+		FString Result = First;
+		((Result = Result / FString(Rest)), ...);
+		return Result;
+	}
+
+	static FString GetPath(const FString& Path);
+	static FString GetCleanFilename(const FString& Path);
+	static FString GetBaseFilename(const FString& Path);
+	// Without the dot
+	static FString GetExtension(const FString& Path);
+
+	static bool FileExists(const FString& Path);
+	static bool DirectoryExists(const FString& Path);
+	static bool MakePathRelativeTo(FString& Path, const TCHAR* RelativeTo);
+};
@@ -0,0 +1,16 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+// Modules are not loaded by anything outside the engine, the host creates FUEFormatModule and starts it itself
+class IModuleInterface
+{
+public:
+	virtual ~IModuleInterface() = default;
+
+	virtual void StartupModule() {}
+	virtual void ShutdownModule() {}
+};
+
+#define IMPLEMENT_MODULE(ModuleImplClass, ModuleName)
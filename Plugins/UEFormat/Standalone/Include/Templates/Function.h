@@ -0,0 +1,38 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include "Templates/UnrealTemplate.h"
+
+template<typename FuncType>
+using TFunction = std::function<FuncType>;
+
+// Non-owning reference to a callable, which has to outlive the reference
+template<typename FuncType>
+class TFunctionRef;
+
+template<typename RetType, typename... ParamTypes>
+class TFunctionRef<RetType(ParamTypes...)>
+{
+public:
+	template<typename FunctorType, typename = std::enable_if_t<!std::is_same_v<std::decay_t<FunctorType>, TFunctionRef>>>
+	TFunctionRef(FunctorType&& Functor)
+		: Callable(const_cast<void*>(static_cast<const void*>(std::addressof(Functor))))
+		, Invoker(&Invoke<std::remove_reference_t<FunctorType>>)
+	{
+	}
+
+	RetType operator()(ParamTypes... Params) const { return Invoker(Callable, Forward<ParamTypes>(Params)...); }
+
+private:
+	template<typename FunctorType>
+	static RetType Invoke(void* Callable, ParamTypes&&... Params)
+	{
+		return (*static_cast<FunctorType*>(Callable))(Forward<ParamTypes>(Params)...);
+	}
+
+	void* Callable;
+	RetType (*Invoker)(void*, ParamTypes&&...);
+};
@@ -0,0 +1,30 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include <memory>
+#include "Templates/UnrealTemplate.h"
+
+template<typename T>
+class TSharedPtr : public std::shared_ptr<T>
+{
+public:
+	using std::shared_ptr<T>::shared_ptr;
+	TSharedPtr(std::shared_ptr<T>&& Other) : std::shared_ptr<T>(MoveTemp(Other)) {}
+
+	bool IsValid() const { return this->get() != nullptr; }
+	T* Get() const { return this->get(); }
+	void Reset() { this->reset(); }
+};
+
+template<typename T>
+class TSharedFromThis : public std::enable_shared_from_this<T>
+{
+public:
+	TSharedPtr<T> AsShared() { return TSharedPtr<T>(this->shared_from_this()); }
+};
+
+template<typename T, typename... ArgTypes>
+TSharedPtr<T> MakeShared(ArgTypes&&... Args)
+{
+	return TSharedPtr<T>(std::make_shared<T>(Forward<ArgTypes>(Args)...));
+}
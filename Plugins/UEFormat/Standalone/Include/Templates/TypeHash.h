@@ -0,0 +1,18 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include <type_traits>
+#include "HAL/Platform.h"
+
+template<typename T>
+std::enable_if_t<std::is_integral_v<T> || std::is_enum_v<T>, uint32> GetTypeHash(T Value)
+{
+	const uint64 Bits = static_cast<uint64>(Value);
+	return static_cast<uint32>(Bits) ^ static_cast<uint32>(Bits >> 32);
+}
+
+template<typename T>
+uint32 GetTypeHash(T* Pointer)
+{
+	return GetTypeHash(reinterpret_cast<UPTRINT>(Pointer) >> 4);
+}
@@ -0,0 +1,25 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include <memory>
+#include "HAL/Platform.h"
+#include "Templates/UnrealTemplate.h"
+
+template<typename T>
+class TUniquePtr : public std::unique_ptr<T>
+{
+public:
+	using std::unique_ptr<T>::unique_ptr;
+	TUniquePtr(std::unique_ptr<T>&& Other) : std::unique_ptr<T>(MoveTemp(Other)) {}
+
+	bool IsValid() const { return this->get() != nullptr; }
+	T* Get() const { return this->get(); }
+	void Reset(T* InPtr = nullptr) { this->reset(InPtr); }
+	T* Release() { return this->release(); }
+};
+
+template<typename T, typename... ArgTypes>
+TUniquePtr<T> MakeUnique(ArgTypes&&... Args)
+{
+	return TUniquePtr<T>(new T(Forward<ArgTypes>(Args)...));
+}
@@ -0,0 +1,17 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include <type_traits>
+#include <utility>
+
+template<typename T>
+constexpr std::remove_reference_t<T>&& MoveTemp(T&& Obj) { return static_cast<std::remove_reference_t<T>&&>(Obj); }
+
+template<typename T>
+constexpr T&& Forward(std::remove_reference_t<T>& Obj) { return static_cast<T&&>(Obj); }
+
+template<typename T>
+constexpr T&& Forward(std::remove_reference_t<T>&& Obj) { return static_cast<T&&>(Obj); }
+
+template<typename T>
+void Swap(T& A, T& B) { std::swap(A, B); }
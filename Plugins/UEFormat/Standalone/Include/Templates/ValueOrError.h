@@ -0,0 +1,62 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include "HAL/Platform.h"
+#include "Templates/UnrealTemplate.h"
+
+// Value and error wrappers returned by MakeValue and MakeError, converted into the TValueOrError they are returned as
+template<typename... ArgTypes> struct TValueOrError_ValueProxy { std::tuple<ArgTypes&&...> Args; };
+template<typename... ArgTypes> struct TValueOrError_ErrorProxy { std::tuple<ArgTypes&&...> Args; };
+
+template<typename... ArgTypes>
+TValueOrError_ValueProxy<ArgTypes...> MakeValue(ArgTypes&&... Args) { return { std::forward_as_tuple(Forward<ArgTypes>(Args)...) }; }
+
+template<typename... ArgTypes>
+TValueOrError_ErrorProxy<ArgTypes...> MakeError(ArgTypes&&... Args) { return { std::forward_as_tuple(Forward<ArgTypes>(Args)...) }; }
+
+template<typename ValueType, typename ErrorType>
+class TValueOrError
+{
+public:
+	template<typename... ArgTypes>
+	TValueOrError(TValueOrError_ValueProxy<ArgTypes...>&& Proxy) { std::apply([this](auto&&... Args) { Value.emplace(Forward<decltype(Args)>(Args)...); }, MoveTemp(Proxy.Args)); }
+	template<typename... ArgTypes>
+	TValueOrError(TValueOrError_ErrorProxy<ArgTypes...>&& Proxy) { std::apply([this](auto&&... Args) { Error.emplace(Forward<decltype(Args)>(Args)...); }, MoveTemp(Proxy.Args)); }
+
+	bool HasValue() const { return Value.has_value(); }
+	bool HasError() const { return Error.has_value(); }
+
+	ValueType& GetValue() { check(HasValue()); return *Value; }
+	const ValueType& GetValue() const { check(HasValue()); return *Value; }
+	ValueType StealValue() { check(HasValue()); ValueType Result = MoveTemp(*Value); Value.reset(); return Result; }
+
+	ErrorType& GetError() { check(HasError()); return *Error; }
+	const ErrorType& GetError() const { check(HasError()); return *Error; }
+	ErrorType StealError() { check(HasError()); ErrorType Result = MoveTemp(*Error); Error.reset(); return Result; }
+
+private:
+	std::optional<ValueType> Value;
+	std::optional<ErrorType> Error;
+};
+
+template<typename ErrorType>
+class TValueOrError<void, ErrorType>
+{
+public:
+	TValueOrError(TValueOrError_ValueProxy<>&&) {}
+	template<typename... ArgTypes>
+	TValueOrError(TValueOrError_ErrorProxy<ArgTypes...>&& Proxy) { std::apply([this](auto&&... Args) { Error.emplace(Forward<decltype(Args)>(Args)...); }, MoveTemp(Proxy.Args)); }
+
+	bool HasValue() const { return !Error.has_value(); }
+	bool HasError() const { return Error.has_value(); }
+
+	ErrorType& GetError() { check(HasError()); return *Error; }
+	const ErrorType& GetError() const { check(HasError()); return *Error; }
+	ErrorType StealError() { check(HasError()); ErrorType Result = MoveTemp(*Error); Error.reset(); return Result; }
+
+private:
+	std::optional<ErrorType> Error;
+};
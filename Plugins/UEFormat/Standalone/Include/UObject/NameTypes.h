@@ -0,0 +1,58 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include "Containers/UnrealString.h"
+
+// Maximum length of a name including the terminator, as in the engine
+#define NAME_SIZE 1024
+
+// Hardcoded names the readers refer to
+enum EName : uint32
+{
+	NAME_None = 0,
+	NAME_Gzip,
+};
+
+// Immutable name. Unlike the engine's there is no global name table, every FName owns its string.
+class FName
+{
+public:
+	FName() = default;
+	FName(EName Name)
+	{
+		if (Name == NAME_Gzip)
+			String = std::make_shared<const std::string>("Gzip");
+	}
+	FName(const ANSICHAR* Name) : FName(Name ? static_cast<int32>(std::strlen(Name)) : 0, Name) {}
+	FName(int32 Len, const ANSICHAR* Name)
+	{
+		// The engine's checkf, kept in release builds so the fuzzers and tests catch a reader passing a long name
+		if (Len >= NAME_SIZE)
+		{
+			std::fprintf(stderr, "FName's %d max length exceeded. Got %d characters excluding null-terminator.\n", NAME_SIZE - 1, Len);
+			std::abort();
+		}
+		if (Len > 0)
+			String = std::make_shared<const std::string>(Name, Len);
+	}
+
+	bool IsNone() const { return !String; }
+	FString ToString() const { return String ? FString(*String) : FString(TEXT("None")); }
+
+	// Like the engine, names compare case-insensitively
+	bool operator==(const FName& Other) const
+	{
+		if (String == Other.String)
+			return true;
+		return String && Other.String && FAnsiStringView(String->data(), static_cast<int32>(String->size())).Equals(
+			FAnsiStringView(Other.String->data(), static_cast<int32>(Other.String->size())), ESearchCase::IgnoreCase);
+	}
+	bool operator!=(const FName& Other) const { return !(*this == Other); }
+
+private:
+	std::shared_ptr<const std::string> String;
+};
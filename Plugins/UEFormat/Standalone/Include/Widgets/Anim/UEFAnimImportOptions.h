@@ -0,0 +1,12 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+// Stands in for the editor's UEFAnimImportOptions.h, which declares an UObject, for the key resampler.
+// Keep in sync with the UENUM there.
+enum class EUEFAnimInterpolation : uint8
+{
+	Step,
+	Linear
+};
@@ -0,0 +1,191 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY(LogTemp)
+
+namespace UEFStandalone
+{
+	ELogVerbosity::Type GetLogVerbosity()
+	{
+		static const ELogVerbosity::Type Verbosity = []()
+		{
+			static const TCHAR* const Names[] = { TEXT("NoLogging"), TEXT("Fatal"), TEXT("Error"), TEXT("Warning"), TEXT("Display"), TEXT("Log"), TEXT("Verbose"), TEXT("VeryVerbose") };
+			if (const char* Value = std::getenv("UEFORMAT_LOG_VERBOSITY"))
+				for (int32 Index = 0; Index <= ELogVerbosity::VeryVerbose; Index++)
+					if (FCString::Stricmp(Value, Names[Index]) == 0)
+						return static_cast<ELogVerbosity::Type>(Index);
+			return ELogVerbosity::Warning;
+		}();
+		return Verbosity;
+	}
+
+	void WriteLog(const FLogCategoryBase& Category, ELogVerbosity::Type Verbosity, const FString& Message)
+	{
+		static std::mutex Mutex;
+		const TCHAR* Prefix = Verbosity <= ELogVerbosity::Error ? TEXT("Error: ") : Verbosity == ELogVerbosity::Warning ? TEXT("Warning: ") : TEXT("");
+
+		std::lock_guard<std::mutex> Lock(Mutex);
+		std::fprintf(stderr, "%s: %s%s\n", Category.Name, Prefix, *Message);
+		if (Verbosity == ELogVerbosity::Fatal)
+			std::abort();
+	}
+
+	namespace
+	{
+		struct FParallelJob
+		{
+			FParallelJob(int32 InNum, TFunctionRef<void(int32)> InBody) : Num(InNum), Body(InBody) {}
+
+			const int32 Num;
+			TFunctionRef<void(int32)> Body;
+			std::atomic<int32> Next{ 0 };
+			// Workers running the job, guarded by the pool's mutex
+			int32 Helpers = 0;
+
+			bool HasWork() const { return Next.load(std::memory_order_relaxed) < Num; }
+
+			void Work()
+			{
+				for (int32 Index = Next++; Index < Num; Index = Next++)
+					Body(Index);
+			}
+		};
+
+		// Workers pick up whatever job is queued, the thread that queued a job works on it as well and so never waits
+		// for a worker to become free. That keeps nested ParallelFor calls from deadlocking.
+		class FWorkerPool
+		{
+		public:
+			FWorkerPool()
+			{
+				int32 NumWorkers = static_cast<int32>(std::thread::hardware_concurrency()) - 1;
+				if (const char* Value = std::getenv("UEFORMAT_WORKER_THREADS"))
+					NumWorkers = FCString::Atoi(Value);
+				for (int32 Index = 0; Index < NumWorkers; Index++)
+					Workers.emplace_back([this]() { WorkerLoop(); });
+			}
+
+			~FWorkerPool() { //Destructor
+				{
+					std::lock_guard<std::mutex> Lock(Mutex);
+					bStopping = true;
+				}
+				WorkAvailable.notify_all();
+				for (std::thread& Worker : Workers)
+					Worker.join();
+			}
+
+			int32 NumWorkers() const { return static_cast<int32>(Workers.size()); }
+
+			void Run(FParallelJob& Job)
+			{
+				{
+					std::lock_guard<std::mutex> Lock(Mutex);
+					Jobs.push_back(&Job);
+				}
+				WorkAvailable.notify_all();
+
+				Job.Work();
+
+				// Every index is taken, wait for workers still running one
+				std::unique_lock<std::mutex> Lock(Mutex);
+				Dequeue(Job);
+				HelperFinished.wait(Lock, [&Job]() { return Job.Helpers == 0; });
+			}
+
+		private:
+			std::mutex Mutex;
+			std::condition_variable WorkAvailable;
+			std::condition_variable HelperFinished;
+			std::vector<FParallelJob*> Jobs;
+			std::vector<std::thread> Workers;
+			bool bStopping = false;
+
+			void Dequeue(FParallelJob& Job)
+			{
+				const auto It = std::find(Jobs.begin(), Jobs.end(), &Job);
+				if (It != Jobs.end())
+					Jobs.erase(It);
+			}
+
+			void WorkerLoop()
+			{
+				std::unique_lock<std::mutex> Lock(Mutex);
+				while (true)
+				{
+					WorkAvailable.wait(Lock, [this]() { return bStopping || !Jobs.empty(); });
+					if (bStopping)
+						return;
+
+					FParallelJob* Job = Jobs.back();
+					if (!Job->HasWork())
+					{
+						Dequeue(*Job);
+						continue;
+					}
+
+					Job->Helpers++;
+					Lock.unlock();
+					Job->Work();
+					Lock.lock();
+					Job->Helpers--;
+					Dequeue(*Job);
+					HelperFinished.notify_all();
+				}
+			}
+		};
+	}
+
+	void ParallelForImpl(int32 Num, TFunctionRef<void(int32)> Body, bool bForceSingleThread)
+	{
+		static FWorkerPool Pool;
+		if (bForceSingleThread || Num <= 1 || Pool.NumWorkers() == 0)
+		{
+			for (int32 Index = 0; Index < Num; Index++)
+				Body(Index);
+			return;
+		}
+
+		FParallelJob Job(Num, Body);
+		Pool.Run(Job);
+	}
+}
+
+IConsoleManager& IConsoleManager::Get()
+{
+	static IConsoleManager Manager;
+	return Manager;
+}
+
+IConsoleVariable* IConsoleManager::FindConsoleVariable(const TCHAR* Name) const
+{
+	for (const TPair<FString, IConsoleVariable*>& Variable : Variables)
+		if (Variable.Key.Equals(Name, ESearchCase::IgnoreCase))
+			return Variable.Value;
+	return nullptr;
+}
+
+void IConsoleManager::RegisterConsoleVariable(const TCHAR* Name, IConsoleVariable* Variable)
+{
+	Variables.Add({ FString(Name), Variable });
+}
+
+void IConsoleManager::UnregisterConsoleVariable(IConsoleVariable* Variable)
+{
+	TArray<TPair<FString, IConsoleVariable*>> Remaining;
+	for (TPair<FString, IConsoleVariable*>& Entry : Variables)
+		if (Entry.Value != Variable)
+			Remaining.Add(MoveTemp(Entry));
+	Variables = MoveTemp(Remaining);
+}
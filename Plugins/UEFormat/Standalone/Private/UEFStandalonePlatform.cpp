@@ -0,0 +1,278 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+#include <fcntl.h>
+#include <fnmatch.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include "CoreMinimal.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#if UEFORMAT_STANDALONE_WITH_ZLIB
+	#include <zlib.h>
+#endif
+
+namespace
+{
+	class FPosixMappedFileRegion : public IMappedFileRegion
+	{
+	public:
+		FPosixMappedFileRegion(void* InMapping, SIZE_T InMappingSize, int64 Skip, int64 Size)
+			: IMappedFileRegion(static_cast<const uint8*>(InMapping) + Skip, Size), Mapping(InMapping), MappingSize(InMappingSize) {}
+
+		~FPosixMappedFileRegion() override { //Destructor
+			munmap(Mapping, MappingSize);
+		}
+
+	private:
+		void* Mapping;
+		SIZE_T MappingSize;
+	};
+
+	class FPosixMappedFileHandle : public IMappedFileHandle
+	{
+	public:
+		FPosixMappedFileHandle(int InFile, int64 InFileSize) : IMappedFileHandle(InFileSize), File(InFile) {}
+
+		~FPosixMappedFileHandle() override { //Destructor
+			close(File);
+		}
+
+		IMappedFileRegion* MapRegion(int64 Offset, int64 BytesToMap, EMappedFileFlags Flags) override
+		{
+			if (Offset < 0 || Offset >= GetFileSize() || BytesToMap <= 0)
+				return nullptr;
+			BytesToMap = FMath::Min(BytesToMap, GetFileSize() - Offset);
+
+			// mmap wants a page aligned offset, the region starts that far into the mapping
+			const int64 PageSize = sysconf(_SC_PAGESIZE);
+			const int64 AlignedOffset = Offset / PageSize * PageSize;
+			const SIZE_T MappingSize = static_cast<SIZE_T>(Offset - AlignedOffset + BytesToMap);
+			const int MapFlags = MAP_PRIVATE | (Flags == EMappedFileFlags::EPreloadHint ? MAP_POPULATE : 0);
+			void* Mapping = mmap(nullptr, MappingSize, PROT_READ, MapFlags, File, AlignedOffset);
+			if (Mapping == MAP_FAILED)
+				return nullptr;
+			return new FPosixMappedFileRegion(Mapping, MappingSize, Offset - AlignedOffset, BytesToMap);
+		}
+
+	private:
+		int File;
+	};
+}
+
+FOpenMappedResult IPlatformFile::OpenMappedEx(const TCHAR* Filename)
+{
+	const int File = open(Filename, O_RDONLY | O_CLOEXEC);
+	if (File < 0)
+		return MakeError(FFileSystemError{ FString::Printf(TEXT("could not open %s"), Filename) });
+
+	struct stat Stat;
+	if (fstat(File, &Stat) != 0 || !S_ISREG(Stat.st_mode))
+	{
+		close(File);
+		return MakeError(FFileSystemError{ FString::Printf(TEXT("%s is not a regular file"), Filename) });
+	}
+	return MakeValue(TUniquePtr<IMappedFileHandle>(new FPosixMappedFileHandle(File, Stat.st_size)));
+}
+
+bool IPlatformFile::FileExists(const TCHAR* Filename)
+{
+	std::error_code Error;
+	return std::filesystem::is_regular_file(Filename, Error);
+}
+
+int64 IPlatformFile::FileSize(const TCHAR* Filename)
+{
+	std::error_code Error;
+	const std::uintmax_t Size = std::filesystem::file_size(Filename, Error);
+	return Error ? INDEX_NONE : static_cast<int64>(Size);
+}
+
+FPlatformFileManager& FPlatformFileManager::Get()
+{
+	static FPlatformFileManager Manager;
+	return Manager;
+}
+
+bool FCompression::UncompressMemory(FName FormatName, void* UncompressedBuffer, int64 UncompressedSize, const void* CompressedBuffer, int64 CompressedSize, ECompressionFlags /*Flags*/, int32 /*CompressionData*/)
+{
+#if UEFORMAT_STANDALONE_WITH_ZLIB
+	if (FormatName != NAME_Gzip || UncompressedSize > MAX_uint32 || CompressedSize > MAX_uint32)
+		return false;
+
+	z_stream Stream = {};
+	Stream.next_in = static_cast<Bytef*>(const_cast<void*>(CompressedBuffer));
+	Stream.avail_in = static_cast<uInt>(CompressedSize);
+	Stream.next_out = static_cast<Bytef*>(UncompressedBuffer);
+	Stream.avail_out = static_cast<uInt>(UncompressedSize);
+	// 16 selects the gzip wrapper
+	if (inflateInit2(&Stream, 16 + MAX_WBITS) != Z_OK)
+		return false;
+	const int Result = inflate(&Stream, Z_FINISH);
+	inflateEnd(&Stream);
+	return Result == Z_STREAM_END && Stream.total_out == static_cast<uLong>(UncompressedSize);
+#else
+	return false;
+#endif
+}
+
+bool FFileHelper::LoadFileToArray(TArray<uint8>& Result, const TCHAR* Filename, uint32 /*Flags*/)
+{
+	std::ifstream File(Filename, std::ios::binary | std::ios::ate);
+	if (!File)
+		return false;
+	const std::streamoff Size = File.tellg();
+	if (Size < 0 || Size > MAX_int32)
+		return false;
+	File.seekg(0);
+	Result.SetNumUninitialized(static_cast<int32>(Size));
+	File.read(reinterpret_cast<char*>(Result.GetData()), Size);
+	return !File.fail();
+}
+
+bool FFileHelper::SaveArrayToFile(TArrayView<const uint8> Array, const TCHAR* Filename)
+{
+	const std::filesystem::path Path(Filename);
+	std::error_code Error;
+	if (Path.has_parent_path())
+		std::filesystem::create_directories(Path.parent_path(), Error);
+	std::ofstream File(Path, std::ios::binary | std::ios::trunc);
+	File.write(reinterpret_cast<const char*>(Array.GetData()), Array.Num());
+	return File.good();
+}
+
+IFileManager& IFileManager::Get()
+{
+	static IFileManager Manager;
+	return Manager;
+}
+
+void IFileManager::FindFiles(TArray<FString>& FoundFiles, const TCHAR* Wildcard, bool bFiles, bool bDirectories)
+{
+	const std::filesystem::path Path(Wildcard);
+	const std::string Pattern = Path.filename().string();
+	std::error_code Error;
+	for (const std::filesystem::directory_entry& Entry : std::filesystem::directory_iterator(Path.parent_path(), Error))
+	{
+		const bool bWanted = Entry.is_directory(Error) ? bDirectories : bFiles;
+		const std::string Name = Entry.path().filename().string();
+		if (bWanted && fnmatch(Pattern.c_str(), Name.c_str(), 0) == 0)
+			FoundFiles.Add(FString(Name));
+	}
+}
+
+void IFileManager::FindFilesRecursive(TArray<FString>& FoundFiles, const TCHAR* StartDirectory, const TCHAR* Wildcard, bool bFiles, bool bDirectories, bool bClearFileNames)
+{
+	if (bClearFileNames)
+		FoundFiles.Empty();
+
+	TArray<FString> Found;
+	std::error_code Error;
+	for (std::filesystem::recursive_directory_iterator It(StartDirectory, Error), End; !Error && It != End; It.increment(Error))
+	{
+		const bool bWanted = It->is_directory(Error) ? bDirectories : bFiles;
+		if (bWanted && fnmatch(Wildcard, It->path().filename().c_str(), 0) == 0)
+			Found.Add(FString(It->path().string()));
+	}
+	Found.Sort([](const FString& A, const FString& B) { return A.ToStdString() < B.ToStdString(); });
+	FoundFiles.Append(Found);
+}
+
+int64 IFileManager::FileSize(const TCHAR* Filename)
+{
+	return FPlatformFileManager::Get().GetPlatformFile().FileSize(Filename);
+}
+
+bool IFileManager::MakeDirectory(const TCHAR* Path, bool bTree)
+{
+	std::error_code Error;
+	if (bTree)
+		std::filesystem::create_directories(Path, Error);
+	else
+		std::filesystem::create_directory(Path, Error);
+	return std::filesystem::is_directory(Path, Error);
+}
+
+bool IFileManager::Delete(const TCHAR* Filename)
+{
+	std::error_code Error;
+	return std::filesystem::remove(Filename, Error);
+}
+
+bool IFileManager::DeleteDirectory(const TCHAR* Path, bool bRequireExists, bool bTree)
+{
+	std::error_code Error;
+	if (!std::filesystem::is_directory(Path, Error))
+		return !bRequireExists;
+	if (bTree)
+		std::filesystem::remove_all(Path, Error);
+	else
+		std::filesystem::remove(Path, Error);
+	return !Error;
+}
+
+FString FPaths::GetPath(const FString& Path)
+{
+	return FString(std::filesystem::path(*Path).parent_path().string());
+}
+
+FString FPaths::GetCleanFilename(const FString& Path)
+{
+	return FString(std::filesystem::path(*Path).filename().string());
+}
+
+FString FPaths::GetBaseFilename(const FString& Path)
+{
+	return FString(std::filesystem::path(*Path).stem().string());
+}
+
+FString FPaths::GetExtension(const FString& Path)
+{
+	const std::string Extension = std::filesystem::path(*Path).extension().string();
+	return FString(Extension.empty() ? Extension : Extension.substr(1));
+}
+
+bool FPaths::FileExists(const FString& Path)
+{
+	return FPlatformFileManager::Get().GetPlatformFile().FileExists(*Path);
+}
+
+bool FPaths::DirectoryExists(const FString& Path)
+{
+	std::error_code Error;
+	return std::filesystem::is_directory(*Path, Error);
+}
+
+bool FPaths::MakePathRelativeTo(FString& Path, const TCHAR* RelativeTo)
+{
+	// Like the engine, RelativeTo names a directory only if it ends in a separator
+	const std::filesystem::path Base = std::filesystem::path(RelativeTo).parent_path();
+	const std::filesystem::path Relative = std::filesystem::path(*Path).lexically_relative(Base);
+	if (Relative.empty())
+		return false;
+	Path = FString(Relative.generic_string());
+	return true;
+}
+
+IPluginManager& IPluginManager::Get()
+{
+	static IPluginManager Manager;
+	return Manager;
+}
+
+TSharedPtr<IPlugin> IPluginManager::FindPlugin(const TCHAR* Name)
+{
+#ifdef UEFORMAT_STANDALONE_PLUGIN_DIR
+	if (FCString::Stricmp(Name, TEXT("UEFormat")) == 0)
+		return MakeShared<IPlugin>(FString(TEXT(UEFORMAT_STANDALONE_PLUGIN_DIR)));
+#endif
+	return TSharedPtr<IPlugin>();
+}
@@ -0,0 +1,185 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+// Reads every .ueanim and .uemodel under a directory through both source modes and checks that they succeed and agree,
+// then writes each one back ZSTD-compressed on two workers and checks that the copy reads the same. Files in a directory
+// named Invalid are malformed on purpose and pass when both source modes reject them.
+// Usage: UEFormatReadSamples <Directory>
+
+#include <cstdio>
+#include <filesystem>
+#include <unistd.h>
+#include "CoreMinimal.h"
+#include "HAL/FileManager.h"
+#include "Readers/UEFAnimReader.h"
+#include "Readers/UEFModelReader.h"
+#include "Writers/UEFAnimWriter.h"
+#include "Writers/UEFModelWriter.h"
+#include "Misc/Paths.h"
+#include "UEFormat.h"
+
+namespace
+{
+	// Order dependent sum over everything a reader produced, equal sums mean equal results
+	struct FChecksum
+	{
+		double Sum = 0.0;
+		int64 Count = 0;
+
+		void Add(double Value) { Sum += Value * static_cast<double>(++Count % 7 + 1); }
+		void Add(const FVector3f& V) { Add(V.X); Add(V.Y); Add(V.Z); }
+		void Add(const FQuat4f& Q) { Add(Q.X); Add(Q.Y); Add(Q.Z); Add(Q.W); }
+		void Add(FAnsiStringView String) { for (const ANSICHAR Char : String) Add(static_cast<double>(Char)); }
+
+		template<typename T>
+		void AddKeys(const TUEFKeyStream<T>& Keys)
+		{
+			for (int32 Index = 0; Index < Keys.Num(); Index++)
+			{
+				Add(static_cast<double>(Keys.Frames[Index]));
+				Add(Keys.Values[Index]);
+			}
+		}
+
+		bool operator==(const FChecksum& Other) const { return Sum == Other.Sum && Count == Other.Count; }
+		// Rotations are normalized again when a written copy is read, which may move them by an ulp
+		bool IsNearlyEqual(const FChecksum& Other) const { return Count == Other.Count && FMath::Abs(Sum - Other.Sum) <= 1e-6 * FMath::Abs(Sum); }
+	};
+
+	const FUEFWriteOptions CopyOptions = { true, 1, 2 };
+
+	// Writes what was read to CopyFile if it is set
+	bool ReadAnim(const FString& File, EUEFSourceMode Mode, FChecksum& OutChecksum, const FString& CopyFile = FString())
+	{
+		UEFAnimReader Reader(File, Mode);
+		const FUEFReadResult Result = Reader.Read();
+		if (Result.HasError())
+		{
+			std::fprintf(stderr, "%s: %s\n", *File, *Result.GetError().ToString());
+			return false;
+		}
+		if (!CopyFile.IsEmpty())
+		{
+			if (const FUEFWriteResult WriteResult = UEFAnimWriter(CopyFile, CopyOptions).Write(Reader); WriteResult.HasError())
+			{
+				std::fprintf(stderr, "%s: %s\n", *CopyFile, *WriteResult.GetError());
+				return false;
+			}
+		}
+
+		OutChecksum.Add(static_cast<double>(Reader.NumFrames));
+		OutChecksum.Add(Reader.FramesPerSecond);
+		OutChecksum.Add(Reader.RefPosePath);
+		for (const FTrack& Track : Reader.Tracks)
+		{
+			OutChecksum.Add(Reader.Names.GetString(Track.TrackName));
+			OutChecksum.AddKeys(Track.PosKeys);
+			OutChecksum.AddKeys(Track.RotKeys);
+			OutChecksum.AddKeys(Track.ScaleKeys);
+		}
+		for (const FCurve& Curve : Reader.Curves)
+		{
+			OutChecksum.Add(Reader.Names.GetString(Curve.CurveName));
+			OutChecksum.AddKeys(Curve.Keys);
+		}
+		return true;
+	}
+
+	bool ReadModel(const FString& File, EUEFSourceMode Mode, FChecksum& OutChecksum, const FString& CopyFile = FString())
+	{
+		UEFModelReader Reader(File, Mode);
+		const FUEFReadResult Result = Reader.Read();
+		if (Result.HasError())
+		{
+			std::fprintf(stderr, "%s: %s\n", *File, *Result.GetError().ToString());
+			return false;
+		}
+		if (!CopyFile.IsEmpty())
+		{
+			if (const FUEFWriteResult WriteResult = UEFModelWriter(CopyFile, CopyOptions).Write(Reader); WriteResult.HasError())
+			{
+				std::fprintf(stderr, "%s: %s\n", *CopyFile, *WriteResult.GetError());
+				return false;
+			}
+		}
+
+		for (const FLODData& LOD : Reader.LODs)
+		{
+			for (const FVector3f& Vertex : LOD.Vertices)
+				OutChecksum.Add(Vertex);
+			for (const int32 Index : LOD.Indices)
+				OutChecksum.Add(static_cast<double>(Index));
+			for (const FMaterialChunk& Material : LOD.Materials)
+				OutChecksum.Add(Reader.Names.GetString(Material.Name));
+			for (int32 VertexIndex = 0; VertexIndex < LOD.Weights.NumVertices(); VertexIndex++)
+			{
+				for (const FWeightChunk& Weight : LOD.Weights.GetVertexWeights(VertexIndex))
+				{
+					OutChecksum.Add(static_cast<double>(VertexIndex));
+					OutChecksum.Add(static_cast<double>(Weight.WeightBoneIndex));
+					OutChecksum.Add(static_cast<double>(Weight.WeightAmount));
+				}
+			}
+		}
+		for (const FBoneChunk& Bone : Reader.Skeleton.Bones)
+		{
+			OutChecksum.Add(Reader.Names.GetString(Bone.BoneName));
+			OutChecksum.Add(Bone.BonePos);
+			OutChecksum.Add(Bone.BoneRot);
+		}
+		return true;
+	}
+}
+
+int main(int ArgC, char* ArgV[])
+{
+	if (ArgC != 2)
+	{
+		std::fprintf(stderr, "Usage: %s <Directory>\n", ArgV[0]);
+		return 2;
+	}
+
+	FUEFormatModule Module;
+	Module.StartupModule();
+
+	TArray<FString> Files;
+	IFileManager::Get().FindFilesRecursive(Files, ArgV[1], TEXT("*.ueanim"), true, false);
+	IFileManager::Get().FindFilesRecursive(Files, ArgV[1], TEXT("*.uemodel"), true, false, false);
+	if (Files.IsEmpty())
+		std::fprintf(stderr, "No .ueanim or .uemodel files under %s\n", ArgV[1]);
+
+	const FString TempDir = FPaths::Combine(FString(std::filesystem::temp_directory_path().string()), FString::Printf(TEXT("UEFormatReadSamples-%d"), static_cast<int32>(getpid())));
+
+	int32 NumFailed = 0;
+	for (int32 Index = 0; Index < Files.Num(); Index++)
+	{
+		const FString& File = Files[Index];
+		const bool bAnim = File.EndsWith(TEXT(".ueanim"));
+		if (FPaths::GetCleanFilename(FPaths::GetPath(File)) == TEXT("Invalid"))
+		{
+			FChecksum Unused;
+			const bool bRejected = bAnim
+				? !ReadAnim(File, EUEFSourceMode::Stream, Unused) && !ReadAnim(File, EUEFSourceMode::MemoryMapped, Unused)
+				: !ReadModel(File, EUEFSourceMode::Stream, Unused) && !ReadModel(File, EUEFSourceMode::MemoryMapped, Unused);
+			std::printf("%s %s (rejected as expected)\n", bRejected ? "OK  " : "FAIL", *File);
+			NumFailed += bRejected ? 0 : 1;
+			continue;
+		}
+		const FString CopyFile = FPaths::Combine(TempDir, FString::Printf(TEXT("%d_%s"), Index, *FPaths::GetCleanFilename(File)));
+		FChecksum Streamed, Mapped, Copy;
+		const bool bRead = bAnim
+			? ReadAnim(File, EUEFSourceMode::Stream, Streamed) && ReadAnim(File, EUEFSourceMode::MemoryMapped, Mapped, CopyFile) && ReadAnim(CopyFile, EUEFSourceMode::Stream, Copy)
+			: ReadModel(File, EUEFSourceMode::Stream, Streamed) && ReadModel(File, EUEFSourceMode::MemoryMapped, Mapped, CopyFile) && ReadModel(CopyFile, EUEFSourceMode::Stream, Copy);
+		if (bRead && !(Streamed == Mapped))
+			std::fprintf(stderr, "%s: streamed and memory mapped reads differ\n", *File);
+		if (bRead && !Copy.IsNearlyEqual(Mapped))
+			std::fprintf(stderr, "%s: the written copy reads differently\n", *File);
+
+		const bool bPassed = bRead && Streamed == Mapped && Copy.IsNearlyEqual(Mapped);
+		std::printf("%s %s (%lld values, checksum %f)\n", bPassed ? "OK  " : "FAIL", *File, static_cast<long long>(Streamed.Count), Streamed.Sum);
+		NumFailed += bPassed ? 0 : 1;
+	}
+
+	IFileManager::Get().DeleteDirectory(*TempDir, false, true);
+	Module.ShutdownModule();
+	return Files.IsEmpty() || NumFailed > 0 ? 1 : 0;
+}
@@ -0,0 +1,453 @@
+// Copyright © 2025 Marcel K. All rights reserved.
+
+// Reads small hand-built files and checks what the readers make of them, for the cases the samples don't cover.
+// Usage: UEFormatUnitTests
+
+#include <cstdio>
+#include <filesystem>
+#include <unistd.h>
+#include "CoreMinimal.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Factories/UEFSkinWeights.h"
+#include "Factories/UEFVertexInstanceMap.h"
+#include "Readers/UEFAnimReader.h"
+#include "Readers/UEFModelReader.h"
+#include "Writers/UEFAnimWriter.h"
+#include "Writers/UEFDictionaryTrainer.h"
+#include "Writers/UEFWriter.h"
+#include "UEFormat.h"
+
+// Reports a failed check and lets the test go on
+#define UEF_TEST_CHECK(Expr) \
+	do { if (!(Expr)) { std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #Expr); ++NumFailedChecks; } } while (0)
+
+namespace
+{
+	int32 NumFailedChecks = 0;
+	FString TempDir;
+
+	FString WriteFile(const TCHAR* Name, const TCHAR* Extension, const char* Identifier, const FUEFPayloadWriter& Writer)
+	{
+		FUEFormatHeader Header;
+		Header.Identifier = Identifier;
+		Header.FileVersionBytes = std::byte{ 1 };
+		Header.ObjectName = "Test";
+		const FString File = FPaths::Combine(TempDir, FString::Printf(TEXT("%s.%s"), Name, Extension));
+		FUEFWriteOptions Options;
+		Options.bCompress = false;
+		if (FUEFWriteResult Result = UEFWriteFile(File, Header, Writer.GetData(), Options); Result.HasError())
+			std::fprintf(stderr, "%s: %s\n", *File, *Result.GetError());
+		return File;
+	}
+
+	// Writes a model with one LOD whose chunks WriteLOD adds, and returns its path
+	FString WriteModel(const TCHAR* Name, TFunctionRef<void(FUEFPayloadWriter&)> WriteLOD)
+	{
+		FUEFPayloadWriter Writer;
+		Writer.BeginChunk("LODS", 1);
+		Writer.BeginEntry("LOD0");
+		WriteLOD(Writer);
+		Writer.End();
+		Writer.End();
+		return WriteFile(Name, TEXT("uemodel"), "UEMODEL", Writer);
+	}
+
+	template<typename T>
+	void WriteKeys(FUEFPayloadWriter& Writer, TFunctionRef<T(int32)> Value, int32 NumKeys)
+	{
+		Writer.Write(NumKeys);
+		for (int32 Frame = 0; Frame < NumKeys; Frame++)
+		{
+			Writer.Write(Frame);
+			Writer.Write(Value(Frame));
+		}
+	}
+
+	template<typename T>
+	void WriteArrayChunk(FUEFPayloadWriter& Writer, FAnsiStringView Name, const TArray<T>& Values)
+	{
+		Writer.BeginChunk(Name, Values.Num());
+		Writer.WriteArray(TConstArrayView<T>(Values));
+		Writer.End();
+	}
+
+	void WriteMaterial(FUEFPayloadWriter& Writer, int32 FirstIndex, int32 NumFaces)
+	{
+		Writer.BeginChunk("MATERIALS", 1);
+		Writer.WriteFString("Material");
+		Writer.WriteFString("/Game/Material");
+		Writer.Write(FirstIndex);
+		Writer.Write(NumFaces);
+		Writer.End();
+	}
+
+	struct FTestWeight
+	{
+		short Bone;
+		int32 Vertex;
+		float Amount;
+	};
+
+	// Packs the weights the way the reader expects them, 10 bytes each
+	void WriteWeights(FUEFPayloadWriter& Writer, const TArray<FTestWeight>& Weights)
+	{
+		Writer.BeginChunk("WEIGHTS", Weights.Num());
+		for (const FTestWeight& Weight : Weights)
+		{
+			Writer.Write(Weight.Bone);
+			Writer.Write(Weight.Vertex);
+			Writer.Write(Weight.Amount);
+		}
+		Writer.End();
+	}
+
+	const TArray<FVector3f> QuadVertices = { FVector3f(0, 0, 0), FVector3f(1, 0, 0), FVector3f(0, 1, 0), FVector3f(1, 1, 0) };
+	const TArray<int32> QuadIndices = { 0, 1, 2, 2, 1, 3 };
+
+	// Reads File through both source modes, and returns whether both failed, naming ChunkName
+	bool FailsToRead(const FString& File, const char* ChunkName)
+	{
+		for (const EUEFSourceMode Mode : { EUEFSourceMode::Stream, EUEFSourceMode::MemoryMapped })
+		{
+			UEFModelReader Reader(File, Mode);
+			const FUEFReadResult Result = Reader.Read();
+			if (!Result.HasError() || Result.GetError().ChunkName.find(ChunkName) == std::string::npos)
+				return false;
+		}
+		return true;
+	}
+
+	void TestLODValidation()
+	{
+		const FString Valid = WriteModel(TEXT("Valid"), [](FUEFPayloadWriter& Writer) {
+			WriteArrayChunk(Writer, "VERTICES", QuadVertices);
+			WriteArrayChunk(Writer, "INDICES", QuadIndices);
+			WriteMaterial(Writer, 0, 2);
+		});
+		UEFModelReader Reader(Valid);
+		UEF_TEST_CHECK(!Reader.Read().HasError());
+
+		const FString IndexOutOfRange = WriteModel(TEXT("IndexOutOfRange"), [](FUEFPayloadWriter& Writer) {
+			WriteArrayChunk(Writer, "VERTICES", QuadVertices);
+			WriteArrayChunk(Writer, "INDICES", TArray<int32>{ 0, 1, 2, 2, 1, 4 });
+		});
+		UEF_TEST_CHECK(FailsToRead(IndexOutOfRange, "INDICES"));
+
+		const FString NegativeIndex = WriteModel(TEXT("NegativeIndex"), [](FUEFPayloadWriter& Writer) {
+			WriteArrayChunk(Writer, "VERTICES", QuadVertices);
+			WriteArrayChunk(Writer, "INDICES", TArray<int32>{ 0, 1, -1 });
+		});
+		UEF_TEST_CHECK(FailsToRead(NegativeIndex, "INDICES"));
+
+		const FString MaterialPastIndices = WriteModel(TEXT("MaterialPastIndices"), [](FUEFPayloadWriter& Writer) {
+			WriteArrayChunk(Writer, "VERTICES", QuadVertices);
+			WriteArrayChunk(Writer, "INDICES", QuadIndices);
+			WriteMaterial(Writer, 3, 2);
+		});
+		UEF_TEST_CHECK(FailsToRead(MaterialPastIndices, "MATERIALS"));
+
+		// Overflows int32 when multiplied out
+		const FString MaterialOverflow = WriteModel(TEXT("MaterialOverflow"), [](FUEFPayloadWriter& Writer) {
+			WriteArrayChunk(Writer, "VERTICES", QuadVertices);
+			WriteArrayChunk(Writer, "INDICES", QuadIndices);
+			WriteMaterial(Writer, 0, 0x60000000);
+		});
+		UEF_TEST_CHECK(FailsToRead(MaterialOverflow, "MATERIALS"));
+
+		const FString ShortNormals = WriteModel(TEXT("ShortNormals"), [](FUEFPayloadWriter& Writer) {
+			WriteArrayChunk(Writer, "VERTICES", QuadVertices);
+			WriteArrayChunk(Writer, "INDICES", QuadIndices);
+			WriteArrayChunk(Writer, "NORMALS", TArray<FVector4f>{ FVector4f(1, 0, 0, 1) });
+		});
+		UEF_TEST_CHECK(FailsToRead(ShortNormals, "NORMALS"));
+
+		const FString ShortTangents = WriteModel(TEXT("ShortTangents"), [](FUEFPayloadWriter& Writer) {
+			WriteArrayChunk(Writer, "VERTICES", QuadVertices);
+			WriteArrayChunk(Writer, "INDICES", QuadIndices);
+			WriteArrayChunk(Writer, "TANGENTS", TArray<FVector3f>{ FVector3f(1, 0, 0) });
+		});
+		UEF_TEST_CHECK(FailsToRead(ShortTangents, "TANGENTS"));
+
+		const FString ShortTexCoords = WriteModel(TEXT("ShortTexCoords"), [](FUEFPayloadWriter& Writer) {
+			WriteArrayChunk(Writer, "VERTICES", QuadVertices);
+			WriteArrayChunk(Writer, "INDICES", QuadIndices);
+			Writer.BeginChunk("TEXCOORDS", 1);
+			Writer.Write(int32(2));
+			Writer.WriteArray(TConstArrayView<FVector2f>(TArray<FVector2f>{ FVector2f(0, 0), FVector2f(1, 0) }));
+			Writer.End();
+		});
+		UEF_TEST_CHECK(FailsToRead(ShortTexCoords, "TEXCOORDS"));
+
+		// ReadLOD validates the LOD too, ReadChunk leaves that to the caller
+		UEFModelReader Indexed(IndexOutOfRange, EUEFSourceMode::MemoryMapped);
+		UEF_TEST_CHECK(!Indexed.Open().HasError());
+		UEF_TEST_CHECK(!Indexed.ReadChunk("INDICES", 0).HasError());
+		UEF_TEST_CHECK(Indexed.ReadLOD(0).HasError());
+	}
+
+	// Trains on models that share their chunk layout and names, then rewrites one against the dictionary
+	void TestDictionaryCompression()
+	{
+		FUEFDictionaryTrainer Trainer;
+		FString Sample;
+		for (int32 Index = 0; Index < 256; Index++)
+		{
+			Sample = WriteModel(*FString::Printf(TEXT("Sample%d"), Index), [Index](FUEFPayloadWriter& Writer) {
+				TArray<FVector3f> Vertices;
+				for (int32 Vertex = 0; Vertex < 16; Vertex++)
+					Vertices.Add(FVector3f(static_cast<float>(Index), static_cast<float>(Vertex), static_cast<float>(Index * Vertex)));
+				WriteArrayChunk(Writer, "VERTICES", Vertices);
+				WriteArrayChunk(Writer, "INDICES", QuadIndices);
+				WriteMaterial(Writer, 0, 2);
+			});
+			FString Error;
+			UEF_TEST_CHECK(Trainer.AddFile(Sample, Error));
+		}
+		const TValueOrError<uint32, FString> DictID = Trainer.Train(4 * 1024);
+		UEF_TEST_CHECK(DictID.HasValue());
+		if (!DictID.HasValue())
+			return;
+
+		const FString Compressed = FPaths::Combine(TempDir, TEXT("DictionaryCompressed.uemodel"));
+		FString Error;
+		UEF_TEST_CHECK(Trainer.CompressFile(Sample, Compressed, Error));
+
+		// Readers find the dictionary through the module, which doesn't have it yet
+		UEF_TEST_CHECK(FailsToRead(Compressed, "ZSTD"));
+		const TSharedPtr<FUEFDictionaryCache> Dictionaries = FUEFormatModule::GetDictionaries();
+		UEF_TEST_CHECK(Dictionaries.IsValid() && Dictionaries->Add(Trainer.GetDictionary()) == DictID.GetValue());
+		for (const EUEFSourceMode Mode : { EUEFSourceMode::Stream, EUEFSourceMode::MemoryMapped })
+		{
+			UEFModelReader Original(Sample, Mode);
+			UEFModelReader Reader(Compressed, Mode);
+			UEF_TEST_CHECK(!Original.Read().HasError() && !Reader.Read().HasError());
+			UEF_TEST_CHECK(Reader.Header.IsCompressed && Reader.LODs.Num() == 1);
+			UEF_TEST_CHECK(Reader.LODs[0].Vertices.Num() == Original.LODs[0].Vertices.Num()
+				&& FMemory::Memcmp(Reader.LODs[0].Vertices.GetData(), Original.LODs[0].Vertices.GetData(), Original.LODs[0].Vertices.Num() * sizeof(FVector3f)) == 0);
+		}
+	}
+
+	// One track keyed on every frame: a position that jumps once, a position moving at constant speed, a rotation
+	// that never changes and no scale keys
+	void TestKeyReduction()
+	{
+		constexpr int32 NumFrames = 10;
+		auto WriteTrack = [](FUEFPayloadWriter& Writer, const char* Name, TFunctionRef<FVector3f(int32)> Position) {
+			Writer.WriteFString(Name);
+			WriteKeys<FVector3f>(Writer, Position, NumFrames);
+			WriteKeys<FQuat4f>(Writer, [](int32) { return FQuat4f(0.0f, 0.0f, 0.38268343f, 0.92387953f); }, NumFrames);
+			Writer.Write(int32(0));
+		};
+		FUEFPayloadWriter Writer;
+		Writer.BeginChunk("METADATA", 1);
+		Writer.Write(NumFrames);
+		Writer.Write(30.0f);
+		Writer.WriteFString("");
+		Writer.Write(uint8(0));
+		Writer.Write(uint8(0));
+		Writer.Write(int32(0));
+		Writer.End();
+		Writer.BeginChunk("TRACKS", 2);
+		WriteTrack(Writer, "Jump", [](int32 Frame) { return FVector3f(1.0f, 2.0f, Frame < 5 ? 3.0f : 4.0f); });
+		WriteTrack(Writer, "Move", [](int32 Frame) { return FVector3f(static_cast<float>(Frame), 0.0f, 0.0f); });
+		Writer.End();
+		const FString File = WriteFile(TEXT("Keys"), TEXT("ueanim"), "UEANIM", Writer);
+
+		UEFAnimReader Anim(File);
+		UEF_TEST_CHECK(!Anim.Read().HasError() && Anim.Tracks.Num() == 2);
+		if (Anim.Tracks.Num() != 2)
+			return;
+
+		// Returns the key counts of the written tracks as position, rotation, scale per track
+		auto WriteReduced = [&Anim](const TCHAR* Name, const FUEFWriteOptions& Options) {
+			TArray<int32> Counts;
+			const FString Reduced = FPaths::Combine(TempDir, FString::Printf(TEXT("%s.ueanim"), Name));
+			if (UEFAnimWriter(Reduced, Options).Write(Anim).HasError())
+				return Counts;
+			UEFAnimReader Reader(Reduced);
+			if (Reader.Read().HasError())
+				return Counts;
+			for (const FTrack& Track : Reader.Tracks)
+			{
+				Counts.Add(Track.PosKeys.Num());
+				Counts.Add(Track.RotKeys.Num());
+				Counts.Add(Track.ScaleKeys.Num());
+			}
+			return Counts;
+		};
+
+		FUEFWriteOptions Options;
+		Options.bCompress = false;
+		UEF_TEST_CHECK(WriteReduced(TEXT("Unreduced"), Options) == (TArray<int32>{ 10, 10, 0, 10, 10, 0 }));
+
+		// Stepping keeps the jump and the last key, every frame of the move changes the value
+		Options.PositionTolerance = 0.001f;
+		Options.RotationTolerance = 0.001f;
+		Options.ScaleTolerance = 0.001f;
+		UEF_TEST_CHECK(WriteReduced(TEXT("Step"), Options) == (TArray<int32>{ 3, 2, 0, 10, 2, 0 }));
+
+		// Interpolating, the move is a single span and the jump needs both of its sides
+		Options.KeyInterpolation = EUEFAnimInterpolation::Linear;
+		UEF_TEST_CHECK(WriteReduced(TEXT("Linear"), Options) == (TArray<int32>{ 4, 2, 0, 2, 2, 0 }));
+
+		// Only the stream whose tolerance is set is reduced, and the reader's keys are left alone
+		Options.RotationTolerance = -1.0f;
+		UEF_TEST_CHECK(WriteReduced(TEXT("PositionOnly"), Options) == (TArray<int32>{ 4, 10, 0, 2, 10, 0 }));
+		UEF_TEST_CHECK(Anim.Tracks[0].PosKeys.Num() == NumFrames && Anim.Tracks[1].PosKeys.Values[9].X == 9.0f);
+	}
+
+	// Two quads side by side. The first shares its diagonal through the indices, the second repeats the diagonal's
+	// positions as vertices of its own, as an exporter does along a UV seam.
+	void TestVertexInstanceWelding()
+	{
+		const FString File = WriteModel(TEXT("Seams"), [](FUEFPayloadWriter& Writer) {
+			WriteArrayChunk(Writer, "VERTICES", TArray<FVector3f>{
+				FVector3f(0, 0, 0), FVector3f(1, 0, 0), FVector3f(0, 1, 0), FVector3f(1, 1, 0),
+				FVector3f(2, 0, 0), FVector3f(1, 0, 0), FVector3f(1, 1, 0), FVector3f(2, 1, 0), FVector3f(1, 1, 0) });
+			WriteArrayChunk(Writer, "INDICES", TArray<int32>{ 0, 1, 2, 2, 1, 3, 5, 4, 6, 8, 4, 7 });
+			WriteMaterial(Writer, 0, 4);
+		});
+		UEFModelReader Reader(File);
+		UEF_TEST_CHECK(!Reader.Read().HasError() && Reader.LODs.Num() == 1);
+		if (Reader.LODs.Num() != 1)
+			return;
+		const FLODData& LOD = Reader.LODs[0];
+
+		FUEFVertexInstanceMap Instances;
+		Instances.Build(LOD, false);
+		UEF_TEST_CHECK(Instances.InstanceVertices.Num() == 12 && Instances.IndexInstances.IsEmpty() && Instances.GetInstance(7) == 7);
+
+		// Vertices 1, 2 and 4 are indexed twice and merge, 5, 6 and 8 sit on the first quad's vertices but stay split.
+		// Vertex 8 duplicates 6 exactly and stays split as well, only the index decides.
+		Instances.Build(LOD, true);
+		UEF_TEST_CHECK(Instances.InstanceVertices.Num() == 9);
+		UEF_TEST_CHECK(Instances.WeldedVertices == (TArray<int32>{ 0, 1, 2, 3, 5, 4, 6, 8, 7 }));
+		UEF_TEST_CHECK(Instances.IndexInstances == (TArray<int32>{ 0, 1, 2, 2, 1, 3, 4, 5, 6, 7, 5, 8 }));
+		for (int32 Index = 0; Index < LOD.Indices.Num(); Index++)
+			UEF_TEST_CHECK(Instances.InstanceVertices[Instances.GetInstance(Index)] == LOD.Indices[Index]);
+
+		// Rebuilding replaces the previous result
+		Instances.Build(LOD, false);
+		UEF_TEST_CHECK(Instances.InstanceVertices.Num() == 12 && Instances.WeldedVertices.IsEmpty());
+	}
+
+	// Weights in no particular vertex order, grouped by the reader and then limited the way the factory does before
+	// handing them to FBoneWeights, whose settings cap a vertex at MAX_TOTAL_INFLUENCES
+	void TestSkinWeights()
+	{
+		constexpr int32 MaxTotalInfluences = 12;
+		auto ReadLOD = [](UEFModelReader& Reader) {
+			UEF_TEST_CHECK(!Reader.Read().HasError() && Reader.LODs.Num() == 1);
+			return Reader.LODs.Num() == 1;
+		};
+
+		// Vertex 1 has no weights and vertex 3 only a zero one
+		const FString Unsorted = WriteModel(TEXT("UnsortedWeights"), [](FUEFPayloadWriter& Writer) {
+			WriteArrayChunk(Writer, "VERTICES", QuadVertices);
+			WriteArrayChunk(Writer, "INDICES", QuadIndices);
+			WriteWeights(Writer, { { 0, 2, 1.0f }, { 1, 0, 0.75f }, { 2, 2, 0.5f }, { 3, 0, 0.25f }, { 4, 3, 0.0f } });
+		});
+		for (const EUEFSourceMode Mode : { EUEFSourceMode::Stream, EUEFSourceMode::MemoryMapped })
+		{
+			UEFModelReader Reader(Unsorted, Mode);
+			if (!ReadLOD(Reader))
+				return;
+			const FSkinWeightsData& Weights = Reader.LODs[0].Weights;
+			UEF_TEST_CHECK(Weights.Offsets == (TArray<int32>{ 0, 2, 2, 4, 5 }));
+			UEF_TEST_CHECK(Weights.NumVertices() == 4 && Weights.Num() == 5);
+			TArray<short> Bones;
+			for (const FWeightChunk& Weight : Weights.Weights)
+				Bones.Add(Weight.WeightBoneIndex);
+			UEF_TEST_CHECK(Bones == (TArray<short>{ 1, 3, 0, 2, 4 }));
+
+			FSkinWeightsData Limited;
+			UEFLimitInfluences(Reader.LODs[0], MaxTotalInfluences, Limited);
+			UEF_TEST_CHECK(Limited.Offsets == (TArray<int32>{ 0, 2, 2, 4, 4 }));
+			UEF_TEST_CHECK(Limited.Num() == 4 && Limited.Weights[0].WeightBoneIndex == 1 && Limited.Weights[0].WeightAmount == 0.75f);
+			UEF_TEST_CHECK(Limited.Weights[2].WeightBoneIndex == 0 && FMath::Abs(Limited.Weights[2].WeightAmount - 2.0f / 3.0f) < 1e-6f);
+		}
+
+		// The reader only knows the payload size when it reaches the weights, so it rejects what no payload could hold
+		for (const int32 Vertex : { -1, 1000000 })
+		{
+			const FString OutOfRange = WriteModel(*FString::Printf(TEXT("WeightVertex%d"), Vertex), [Vertex](FUEFPayloadWriter& Writer) {
+				WriteArrayChunk(Writer, "VERTICES", QuadVertices);
+				WriteArrayChunk(Writer, "INDICES", QuadIndices);
+				WriteWeights(Writer, { { 0, 0, 1.0f }, { 0, Vertex, 1.0f } });
+			});
+			UEF_TEST_CHECK(FailsToRead(OutOfRange, "WEIGHTS"));
+		}
+
+		// Vertex 0 has 15 weights of 1 to 14, bones 2 and 14 tie for the last influence that is kept. Vertex 5 is
+		// within the payload but past the vertices, which the limiting clamps to.
+		const FString Capped = WriteModel(TEXT("CappedWeights"), [](FUEFPayloadWriter& Writer) {
+			WriteArrayChunk(Writer, "VERTICES", QuadVertices);
+			WriteArrayChunk(Writer, "INDICES", QuadIndices);
+			TArray<FTestWeight> Weights;
+			for (short Bone = 0; Bone < 14; Bone++)
+				Weights.Add({ Bone, 0, static_cast<float>(Bone + 1) });
+			Weights.Add({ 14, 0, 3.0f });
+			Weights.Add({ 15, 5, 1.0f });
+			WriteWeights(Writer, Weights);
+		});
+		UEFModelReader Reader(Capped);
+		if (!ReadLOD(Reader))
+			return;
+		UEF_TEST_CHECK(Reader.LODs[0].Weights.NumVertices() == 6);
+
+		FSkinWeightsData Limited;
+		UEFLimitInfluences(Reader.LODs[0], MaxTotalInfluences, Limited);
+		UEF_TEST_CHECK(Limited.Offsets == (TArray<int32>{ 0, 12, 12, 12, 12 }));
+		if (Limited.Num() != 12)
+			return;
+		float Sum = 0.0f;
+		for (int32 Index = 0; Index < 12; Index++)
+		{
+			const short Bone = Index < 11 ? static_cast<short>(13 - Index) : 2;
+			UEF_TEST_CHECK(Limited.Weights[Index].WeightBoneIndex == Bone);
+			UEF_TEST_CHECK(FMath::Abs(Limited.Weights[Index].WeightAmount - (Bone + 1) / 102.0f) < 1e-6f);
+			Sum += Limited.Weights[Index].WeightAmount;
+		}
+		UEF_TEST_CHECK(FMath::Abs(Sum - 1.0f) < 1e-5f);
+
+		// A lower cap keeps fewer of the same weights
+		UEFLimitInfluences(Reader.LODs[0], 4, Limited);
+		UEF_TEST_CHECK(Limited.Offsets == (TArray<int32>{ 0, 4, 4, 4, 4 }) && Limited.Weights[3].WeightBoneIndex == 10);
+	}
+
+	struct FTest
+	{
+		const char* Name;
+		void (*Run)();
+	};
+
+	const FTest Tests[] = {
+		{ "LODValidation", &TestLODValidation },
+		{ "DictionaryCompression", &TestDictionaryCompression },
+		{ "KeyReduction", &TestKeyReduction },
+		{ "VertexInstanceWelding", &TestVertexInstanceWelding },
+		{ "SkinWeights", &TestSkinWeights },
+	};
+}
+
+int main()
+{
+	FUEFormatModule Module;
+	Module.StartupModule();
+	TempDir = FPaths::Combine(FString(std::filesystem::temp_directory_path().string()), FString::Printf(TEXT("UEFormatUnitTests-%d"), static_cast<int32>(getpid())));
+
+	int32 NumFailed = 0;
+	for (const FTest& Test : Tests)
+	{
+		const int32 FailedBefore = NumFailedChecks;
+		Test.Run();
+		const bool bPassed = NumFailedChecks == FailedBefore;
+		std::printf("%s %s\n", bPassed ? "OK  " : "FAIL", Test.Name);
+		NumFailed += bPassed ? 0 : 1;
+	}
+
+	IFileManager::Get().DeleteDirectory(*TempDir, false, true);
+	Module.ShutdownModule();
+	return NumFailed > 0 ? 1 : 0;
+}